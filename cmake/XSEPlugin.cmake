@@ -1,5 +1,6 @@
 option(BUILD_SKYRIM "Build for Skyrim" OFF)
 option(BUILD_FALLOUT4 "Build for Fallout 4" OFF)
+option(MAINT_PROFILING "Compile hot-path timing probes (p50/p95/p99/max dumped to the log)" OFF)
 
 if(BUILD_SKYRIM)
 	add_compile_definitions(SKYRIM)
@@ -25,6 +26,12 @@ target_compile_features(
 		cxx_std_23
 )
 
+target_compile_definitions(
+	"${PROJECT_NAME}"
+	PRIVATE
+		MAINT_PROFILING=$<BOOL:${MAINT_PROFILING}>
+)
+
 set_property(GLOBAL PROPERTY USE_FOLDERS ON)
 
 include(AddCXXFiles)
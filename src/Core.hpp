@@ -0,0 +1,1874 @@
+#pragma once
+
+// Engine-independent building blocks used by the supervisor and its registries.
+// Standard library only: nothing in here may reach into CommonLib or SKSE.
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <execution>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#	define MAINT_CORE_X64 1
+#	include <immintrin.h>
+#	if defined(_MSC_VER)
+#		include <intrin.h>
+#		define MAINT_TARGET_AVX2
+#	else
+#		define MAINT_TARGET_AVX2 __attribute__((target("avx2")))
+#	endif
+#endif
+
+namespace Maint::Core
+{
+	// ===== Slot table ============================================================
+
+	// Generation-checked reference to a slot. Goes stale once the entry is released,
+	// even if the slot is later reused.
+	struct SlotHandle
+	{
+		static constexpr std::uint16_t kInvalidSlot = 0xFFFF;
+
+		std::uint16_t slot{ kInvalidSlot };
+		std::uint16_t generation{ 0 };
+
+		explicit operator bool() const noexcept { return slot != kInvalidSlot; }
+		friend bool operator==(const SlotHandle&, const SlotHandle&) = default;
+	};
+
+	// Maps stable handles onto positions in dense columns owned by the caller. The owner
+	// mirrors every call on its own columns: push_back after Acquire, swap-remove with
+	// SwapRemove, clear with Clear.
+	class SlotTable
+	{
+	public:
+		std::size_t size() const noexcept { return denseToSlot_.size(); }
+
+		void reserve(std::size_t n)
+		{
+			denseToSlot_.reserve(n);
+		}
+
+		// Handle for a new entry at dense position size()
+		SlotHandle Acquire()
+		{
+			std::uint16_t slot;
+			if (!freeSlots_.empty()) {
+				slot = freeSlots_.back();
+				freeSlots_.pop_back();
+			} else {
+				slot = static_cast<std::uint16_t>(slots_.size());
+				slots_.emplace_back();
+			}
+
+			slots_[slot].dense = static_cast<std::uint16_t>(denseToSlot_.size());
+			denseToSlot_.push_back(slot);
+			return { slot, slots_[slot].generation };
+		}
+
+		// Dense position of a live handle; -1 when it is stale
+		std::ptrdiff_t Resolve(SlotHandle handle) const noexcept
+		{
+			if (!handle || handle.slot >= slots_.size()) {
+				return -1;
+			}
+
+			const auto& info = slots_[handle.slot];
+			return info.generation == handle.generation ? static_cast<std::ptrdiff_t>(info.dense) : -1;
+		}
+
+		SlotHandle HandleAt(std::size_t dense) const noexcept
+		{
+			const auto slot = denseToSlot_[dense];
+			return { slot, slots_[slot].generation };
+		}
+
+		// Releases the entry at `dense`; the last entry moves into its place
+		void SwapRemove(std::size_t dense)
+		{
+			const auto slot = denseToSlot_[dense];
+			++slots_[slot].generation;
+			freeSlots_.push_back(slot);
+
+			const auto last = denseToSlot_.size() - 1;
+			if (dense != last) {
+				denseToSlot_[dense] = denseToSlot_[last];
+				slots_[denseToSlot_[dense]].dense = static_cast<std::uint16_t>(dense);
+			}
+			denseToSlot_.pop_back();
+		}
+
+		// Every live handle goes stale; slots stay allocated for reuse
+		void Clear()
+		{
+			for (const auto slot : denseToSlot_) {
+				++slots_[slot].generation;
+				freeSlots_.push_back(slot);
+			}
+			denseToSlot_.clear();
+		}
+
+	private:
+		struct SlotInfo
+		{
+			std::uint16_t dense{ 0 };
+			std::uint16_t generation{ 0 };
+		};
+
+		std::vector<SlotInfo> slots_;
+		std::vector<std::uint16_t> freeSlots_;
+		std::vector<std::uint16_t> denseToSlot_;
+	};
+
+	// Keyed entries stored as dense parallel columns behind a SlotTable, built for whole-table
+	// sweeps. Keys are found by a linear scan of their own column, so key lookups are meant
+	// for tens of entries. Erasing swap-removes, so dense positions move; handles do not.
+	template <class Key, class... Columns>
+	class DenseTable
+	{
+	public:
+		using Handle = SlotHandle;
+
+		std::size_t size() const noexcept { return keys_.size(); }
+		bool empty() const noexcept { return keys_.empty(); }
+
+		void reserve(std::size_t n)
+		{
+			slots_.reserve(n);
+			keys_.reserve(n);
+			std::apply([n](auto&... columns) { (columns.reserve(n), ...); }, columns_);
+		}
+
+		std::span<Key> keys() noexcept { return keys_; }
+		std::span<const Key> keys() const noexcept { return keys_; }
+
+		template <std::size_t I>
+		auto column() noexcept { return std::span{ std::get<I>(columns_) }; }
+		template <std::size_t I>
+		auto column() const noexcept { return std::span{ std::as_const(std::get<I>(columns_)) }; }
+
+		// Dense position of a key; -1 when absent
+		std::ptrdiff_t IndexOf(const Key& key) const noexcept
+		{
+			const auto it = std::ranges::find(keys_, key);
+			return it != keys_.end() ? it - keys_.begin() : -1;
+		}
+
+		Handle Find(const Key& key) const noexcept
+		{
+			const auto index = IndexOf(key);
+			return index >= 0 ? slots_.HandleAt(static_cast<std::size_t>(index)) : Handle{};
+		}
+
+		// Dense position of a live handle; -1 when it is stale
+		std::ptrdiff_t Resolve(Handle handle) const noexcept { return slots_.Resolve(handle); }
+		Handle HandleAt(std::size_t index) const noexcept { return slots_.HandleAt(index); }
+
+		// Appends an entry, or overwrites the columns of an existing key in place
+		Handle Insert(const Key& key, Columns... values)
+		{
+			if (const auto index = IndexOf(key); index >= 0) {
+				std::apply([&](auto&... columns) { ((columns[static_cast<std::size_t>(index)] = std::move(values)), ...); }, columns_);
+				return slots_.HandleAt(static_cast<std::size_t>(index));
+			}
+
+			const auto handle = slots_.Acquire();
+			keys_.push_back(key);
+			std::apply([&](auto&... columns) { (columns.push_back(std::move(values)), ...); }, columns_);
+			return handle;
+		}
+
+		// The last entry moves into `index`
+		void EraseAt(std::size_t index)
+		{
+			slots_.SwapRemove(index);
+			SwapPop(keys_, index);
+			std::apply([index](auto&... columns) { (SwapPop(columns, index), ...); }, columns_);
+		}
+
+		void Clear()
+		{
+			slots_.Clear();
+			keys_.clear();
+			std::apply([](auto&... columns) { (columns.clear(), ...); }, columns_);
+		}
+
+	private:
+		template <class T>
+		static void SwapPop(std::vector<T>& column, std::size_t index)
+		{
+			if (index + 1 != column.size()) {
+				column[index] = std::move(column.back());
+			}
+			column.pop_back();
+		}
+
+		SlotTable slots_;
+		std::vector<Key> keys_;
+		std::tuple<std::vector<Columns>...> columns_;
+	};
+
+	// ===== Two-level bitmap ======================================================
+
+	// Set of indices in [0, capacity) with O(1) first-free lookup: one summary word flags
+	// which leaf words still have a clear bit, so both levels resolve with countr_zero.
+	class TwoLevelBitmap
+	{
+	public:
+		static constexpr std::size_t kWordBits = 64;
+		static constexpr std::size_t kMaxCapacity = kWordBits * kWordBits;
+
+		// Resets to an empty set of the given capacity (clamped to kMaxCapacity)
+		void Resize(std::size_t capacity)
+		{
+			capacity_ = (std::min)(capacity, kMaxCapacity);
+			leaves_.assign((capacity_ + kWordBits - 1) / kWordBits, 0);
+			Clear();
+		}
+
+		std::size_t capacity() const noexcept { return capacity_; }
+		std::size_t count() const noexcept { return count_; }
+		bool full() const noexcept { return summary_ == 0; }
+
+		// Leaf words; bits past capacity in the last word read as set
+		std::span<const std::uint64_t> words() const noexcept { return leaves_; }
+
+		bool Test(std::size_t index) const noexcept
+		{
+			return index < capacity_ && (leaves_[index / kWordBits] & Bit(index)) != 0;
+		}
+
+		std::optional<std::size_t> SetFirstClear() noexcept
+		{
+			if (summary_ == 0) {
+				return std::nullopt;
+			}
+
+			const auto word = static_cast<std::size_t>(std::countr_zero(summary_));
+			const auto index = word * kWordBits + static_cast<std::size_t>(std::countr_zero(~leaves_[word]));
+			Set(index);
+			return index;
+		}
+
+		// Returns false if the bit was already set or is out of range
+		bool Set(std::size_t index) noexcept
+		{
+			if (index >= capacity_ || Test(index)) {
+				return false;
+			}
+
+			const auto word = index / kWordBits;
+			leaves_[word] |= Bit(index);
+			if (leaves_[word] == ~0ull) {
+				summary_ &= ~(1ull << word);
+			}
+			++count_;
+			return true;
+		}
+
+		// Returns false if the bit was already clear or is out of range
+		bool Reset(std::size_t index) noexcept
+		{
+			if (!Test(index)) {
+				return false;
+			}
+
+			const auto word = index / kWordBits;
+			leaves_[word] &= ~Bit(index);
+			summary_ |= 1ull << word;
+			--count_;
+			return true;
+		}
+
+		void Clear() noexcept
+		{
+			std::ranges::fill(leaves_, 0);
+			summary_ = 0;
+			count_ = 0;
+
+			for (std::size_t w = 0; w < leaves_.size(); ++w) {
+				summary_ |= 1ull << w;
+			}
+
+			// Pin the tail of a partial last word so it is never handed out
+			if (const auto tail = capacity_ % kWordBits; tail != 0) {
+				leaves_.back() = ~0ull << tail;
+			}
+		}
+
+	private:
+		static constexpr std::uint64_t Bit(std::size_t index) noexcept
+		{
+			return 1ull << (index % kWordBits);
+		}
+
+		std::vector<std::uint64_t> leaves_;
+		std::uint64_t summary_{ 0 };
+		std::size_t capacity_{ 0 };
+		std::size_t count_{ 0 };
+	};
+
+	// ===== ID range allocator ====================================================
+
+	// Hands out IDs from [base + minLocal, base + minLocal + capacity), one bitmap index
+	// per ID. The range only changes while nothing is allocated.
+	class IdRangeAllocator
+	{
+	public:
+		IdRangeAllocator(std::uint32_t base, std::uint32_t minLocal, std::size_t capacity) :
+			base_(base),
+			minLocal_(minLocal)
+		{
+			allocated_.Resize(capacity);
+		}
+
+		// Returns false, keeping the current range, while any ID is allocated
+		bool Resize(std::size_t capacity)
+		{
+			if (allocated_.count() != 0) {
+				return false;
+			}
+			allocated_.Resize(capacity);
+			return true;
+		}
+
+		std::size_t capacity() const noexcept { return allocated_.capacity(); }
+		std::size_t count() const noexcept { return allocated_.count(); }
+		std::size_t free() const noexcept { return allocated_.capacity() - allocated_.count(); }
+
+		std::uint32_t IdAt(std::size_t index) const noexcept { return base_ + minLocal_ + static_cast<std::uint32_t>(index); }
+
+		bool InRange(std::uint32_t id) const noexcept
+		{
+			const std::uint32_t local = id - base_;
+			return local >= minLocal_ && local - minLocal_ < allocated_.capacity();
+		}
+
+		std::optional<std::uint32_t> Allocate() noexcept
+		{
+			const auto index = allocated_.SetFirstClear();
+			if (!index) {
+				return std::nullopt;
+			}
+			return IdAt(*index);
+		}
+
+		// Returns false when the ID is out of range or already allocated
+		bool AllocateSpecific(std::uint32_t id) noexcept
+		{
+			return InRange(id) && allocated_.Set(IndexOf(id));
+		}
+
+		// Returns false when the ID is out of range or was not allocated
+		bool Free(std::uint32_t id) noexcept
+		{
+			return InRange(id) && allocated_.Reset(IndexOf(id));
+		}
+
+		bool IsAllocated(std::uint32_t id) const noexcept
+		{
+			return InRange(id) && allocated_.Test(IndexOf(id));
+		}
+
+		void Clear() noexcept { allocated_.Clear(); }
+
+		// Frees every allocated ID that markAll(mark) does not pass to mark(id); IDs outside
+		// the range are ignored. Calls onFreed(id) per freed ID and returns how many there were.
+		template <class MarkAll, class OnFreed>
+		std::size_t Reconcile(MarkAll&& markAll, OnFreed&& onFreed)
+		{
+			const auto allocated = allocated_.words();
+			referenced_.assign(allocated.size(), 0);
+
+			markAll([&](std::uint32_t id) {
+				if (InRange(id)) {
+					const auto index = IndexOf(id);
+					referenced_[index / TwoLevelBitmap::kWordBits] |= 1ull << (index % TwoLevelBitmap::kWordBits);
+				}
+			});
+
+			// Word at a time; only stale bits are visited individually
+			std::size_t freed = 0;
+			for (std::size_t word = 0; word < allocated.size(); ++word) {
+				std::uint64_t stale = allocated[word] & ~referenced_[word];
+
+				while (stale != 0) {
+					const auto index = word * TwoLevelBitmap::kWordBits + static_cast<std::size_t>(std::countr_zero(stale));
+					stale &= stale - 1;
+
+					// Tail bits past the range are pinned, not allocated
+					if (index >= allocated_.capacity()) {
+						break;
+					}
+
+					allocated_.Reset(index);
+					onFreed(IdAt(index));
+					++freed;
+				}
+			}
+			return freed;
+		}
+
+	private:
+		std::size_t IndexOf(std::uint32_t id) const noexcept { return id - base_ - minLocal_; }
+
+		std::uint32_t base_;
+		std::uint32_t minLocal_;
+		TwoLevelBitmap allocated_;
+		std::vector<std::uint64_t> referenced_;  // Reconcile scratch, one word per leaf
+	};
+
+	// ===== Dense ID flags ========================================================
+
+	// One flag per ID of a fixed set. IDs are kept sorted, so an ID's position is its dense
+	// index and a lookup is a binary search plus a bit test. Flags are stored a word at a time,
+	// so disjoint words can be filled from different threads.
+	class DenseIdFlags
+	{
+	public:
+		static constexpr std::size_t kWordBits = 64;
+
+		// Replaces the ID set (duplicates dropped) and clears every flag
+		void Assign(std::vector<std::uint32_t> ids)
+		{
+			std::ranges::sort(ids);
+			const auto dupes = std::ranges::unique(ids);
+			ids.erase(dupes.begin(), dupes.end());
+
+			ids_ = std::move(ids);
+			words_.assign((ids_.size() + kWordBits - 1) / kWordBits, 0);
+		}
+
+		std::size_t size() const noexcept { return ids_.size(); }
+		std::size_t wordCount() const noexcept { return words_.size(); }
+		std::uint32_t IdAt(std::size_t index) const noexcept { return ids_[index]; }
+
+		// Overwrites the flags of dense indices [word * 64, word * 64 + 64)
+		void StoreWord(std::size_t word, std::uint64_t bits) noexcept
+		{
+			const auto valid = ids_.size() - word * kWordBits;
+			words_[word] = valid >= kWordBits ? bits : bits & ((1ull << valid) - 1);
+		}
+
+		// Sets the flag of every dense index i to pred(i), one task per 64-index word so
+		// tasks never share a word; under a parallel policy `pred` runs concurrently
+		template <class ExecutionPolicy, class Pred>
+		void Classify(ExecutionPolicy&& policy, Pred pred)
+		{
+			std::vector<std::size_t> words(words_.size());
+			std::iota(words.begin(), words.end(), std::size_t{ 0 });
+			std::for_each(std::forward<ExecutionPolicy>(policy), words.begin(), words.end(), [&](std::size_t word) {
+				const auto first = word * kWordBits;
+				const auto last = (std::min)(first + kWordBits, ids_.size());
+
+				std::uint64_t bits = 0;
+				for (auto i = first; i < last; ++i) {
+					if (pred(i)) {
+						bits |= 1ull << (i - first);
+					}
+				}
+				StoreWord(word, bits);
+			});
+		}
+
+		std::optional<std::size_t> IndexOf(std::uint32_t id) const noexcept
+		{
+			const auto it = std::ranges::lower_bound(ids_, id);
+			if (it == ids_.end() || *it != id) {
+				return std::nullopt;
+			}
+			return static_cast<std::size_t>(it - ids_.begin());
+		}
+
+		// Flag of a known ID; std::nullopt when the ID is not in the set
+		std::optional<bool> Lookup(std::uint32_t id) const noexcept
+		{
+			const auto index = IndexOf(id);
+			if (!index) {
+				return std::nullopt;
+			}
+			return (words_[*index / kWordBits] >> (*index % kWordBits) & 1) != 0;
+		}
+
+		std::size_t count() const noexcept
+		{
+			std::size_t n = 0;
+			for (const auto word : words_) {
+				n += static_cast<std::size_t>(std::popcount(word));
+			}
+			return n;
+		}
+
+	private:
+		std::vector<std::uint32_t> ids_;
+		std::vector<std::uint64_t> words_;
+	};
+
+	// ===== Inline ID set =========================================================
+
+	// Small unordered set of (value, id) pairs. Up to N entries live inline; larger sets
+	// spill into vectors whose capacity is kept across clear().
+	template <class T, class Id, std::size_t N>
+	class InlineIdSet
+	{
+	public:
+		static constexpr std::size_t kInline = N;
+
+		std::size_t size() const noexcept { return size_; }
+		bool empty() const noexcept { return size_ == 0; }
+
+		const T* begin() const noexcept { return data(); }
+		const T* end() const noexcept { return data() + size_; }
+
+		void push(T value, Id id)
+		{
+			if (!spilled_ && size_ < kInline) {
+				inlineValues_[size_] = value;
+				inlineIDs_[size_] = id;
+				++size_;
+				return;
+			}
+
+			if (!spilled_) {
+				spillValues_.assign(inlineValues_.begin(), inlineValues_.begin() + size_);
+				spillIDs_.assign(inlineIDs_.begin(), inlineIDs_.begin() + size_);
+				spilled_ = true;
+			}
+
+			spillValues_.push_back(value);
+			spillIDs_.push_back(id);
+			++size_;
+		}
+
+		bool contains(Id id) const noexcept
+		{
+			const auto* ids = spilled_ ? spillIDs_.data() : inlineIDs_.data();
+			return std::find(ids, ids + size_, id) != ids + size_;
+		}
+
+		bool erase(Id id)
+		{
+			auto* values = spilled_ ? spillValues_.data() : inlineValues_.data();
+			auto* ids = spilled_ ? spillIDs_.data() : inlineIDs_.data();
+
+			for (std::uint32_t i = 0; i < size_; ++i) {
+				if (ids[i] != id) {
+					continue;
+				}
+
+				// Order is irrelevant to callers; swap the tail in
+				--size_;
+				values[i] = values[size_];
+				ids[i] = ids[size_];
+				if (spilled_) {
+					spillValues_.pop_back();
+					spillIDs_.pop_back();
+				}
+				return true;
+			}
+			return false;
+		}
+
+		void clear() noexcept
+		{
+			spillValues_.clear();
+			spillIDs_.clear();
+			spilled_ = false;
+			size_ = 0;
+		}
+
+	private:
+		const T* data() const noexcept
+		{
+			return spilled_ ? spillValues_.data() : inlineValues_.data();
+		}
+
+		std::array<T, N> inlineValues_{};
+		std::array<Id, N> inlineIDs_{};
+		std::vector<T> spillValues_{};
+		std::vector<Id> spillIDs_{};
+		std::uint32_t size_{ 0 };
+		bool spilled_{ false };
+	};
+
+	// ===== Effect index ==========================================================
+
+	// Active effects of one actor grouped by the maintained spell they count towards. Built by
+	// one walk of the actor's effect list, then kept current by apply/remove deltas; only an
+	// Invalidate(), a delta queue overflow or a change of actor walks the list again.
+	//
+	// Traits adapts the engine, all static:
+	//   Actor, Effect, Spell, Key, Context        types; Key identifies an actor's delta queue
+	//   Key KeyOf(Actor*)
+	//   Key WatchedKey()                          actor whose deltas HasPendingDeltas() reports
+	//   Context ContextFor(Actor*)                classification state, taken once per rebuild
+	//   void ForEachEffect(Actor*, fn)            fn(Effect*) over every active effect, stopping
+	//                                             as soon as fn returns false
+	//   std::uint16_t IdOf(const Effect*)         unique ID, as reported with the deltas
+	//   Classification Classify(Context, Effect*) { Spell* spell; bool pinned; }; null spell skips
+	//   bool CameFrom(const Effect*, const Spell*)
+	//   void Pin(Effect*)                         holds the effect's elapsed time at zero
+	//   RebuildProbe                              RAII type constructed around each rebuild
+	template <class Traits>
+	class EffectIndex
+	{
+	public:
+		using Actor = typename Traits::Actor;
+		using Effect = typename Traits::Effect;
+		using Spell = typename Traits::Spell;
+		using Key = typename Traits::Key;
+
+		// Effects attributed to one maintained spell, keyed by their unique ID
+		using EffectSet = InlineIdSet<Effect*, std::uint16_t, 8>;
+
+		// Past this many queued deltas a full resync is cheaper than replaying them
+		static constexpr std::size_t kMaxPendingDeltas = 256;
+
+		// Validates the index for this actor (applying its queued deltas) and returns it
+		const EffectIndex& GetFor(Actor* actor)
+		{
+			if (actor != builtFor_ || builtGeneration_ != generation_.load(std::memory_order_relaxed) ||
+				!applyDeltas(actor)) {
+				rebuild(actor);
+				return *this;
+			}
+
+			// Keep maintained effects from ageing, as a full rebuild would. Stored pointers can
+			// outlive their effect until its removal delta is replayed, so only live ones are touched.
+			if (std::ranges::any_of(slots_, [](const Slot& slot) { return slot.pinned && !slot.effects.empty(); })) {
+				Traits::ForEachEffect(actor, [&](Effect* e) {
+					for (const auto& slot : slots_) {
+						if (slot.pinned && Traits::CameFrom(e, slot.spell)) {
+							Traits::Pin(e);
+							break;
+						}
+					}
+					return true;
+				});
+			}
+			return *this;
+		}
+
+		void Clear()
+		{
+			unsubscribe();
+			for (auto& slot : slots_) {
+				slot.spell = nullptr;
+				slot.effects.clear();
+			}
+			builtFor_ = nullptr;
+			context_ = {};
+			builtGeneration_ = 0;
+		}
+
+		// Lookup into the last validated index; nullptr when no effects are attributed
+		const EffectSet* find(const Spell* maintained) const noexcept
+		{
+			for (const auto& slot : slots_) {
+				if (slot.spell == maintained) {
+					return slot.effects.empty() ? nullptr : &slot.effects;
+				}
+			}
+			return nullptr;
+		}
+		bool contains(const Spell* maintained) const noexcept { return find(maintained) != nullptr; }
+
+		// Forces a full resync of every index; used when a registry changes
+		static void Invalidate() noexcept { generation_.fetch_add(1, std::memory_order_relaxed); }
+
+		// Queues a single effect delta. Only actors with a built index are listened to;
+		// deltas for anyone else are dropped. Any thread.
+		static void OnEffectChanged(Key actor, std::uint16_t uniqueID, bool applied)
+		{
+			const std::scoped_lock lock{ pendingMtx_ };
+
+			const auto it = pending_.find(actor);
+			if (it == pending_.end()) {
+				return;
+			}
+
+			auto& queue = it->second;
+			if (queue.deltas.size() >= kMaxPendingDeltas) {
+				queue.deltas.clear();
+				queue.overflowed = true;
+			} else {
+				queue.deltas.push_back({ uniqueID, applied });
+			}
+			if (actor == Traits::WatchedKey()) {
+				hasPending_.store(true, std::memory_order_relaxed);
+			}
+		}
+
+		// Whether the watched actor has queued deltas; cheap enough to poll every frame
+		static bool HasPendingDeltas() noexcept { return hasPending_.load(std::memory_order_relaxed); }
+
+		// Hands over the maintained spells that lost an effect since the last call
+		void TakeRemovals(std::vector<Spell*>& out)
+		{
+			out.swap(removedFrom_);
+			removedFrom_.clear();
+		}
+
+		// Full walks of the effect list so far
+		std::size_t rebuilds() const noexcept { return rebuilds_; }
+
+	private:
+		struct Slot
+		{
+			Spell* spell{ nullptr };
+			bool pinned{ false };  // keyword-marked maintained spell; elapsed time is held at zero
+			EffectSet effects{};
+		};
+
+		struct Delta
+		{
+			std::uint16_t uniqueID{ 0 };
+			bool applied{ false };
+		};
+
+		struct DeltaQueue
+		{
+			std::vector<Delta> deltas{};
+			bool overflowed{ false };  // deltas were dropped; the owner must rebuild
+		};
+
+		void rebuild(Actor* actor)
+		{
+			[[maybe_unused]] const typename Traits::RebuildProbe probe{};
+			++rebuilds_;
+
+			for (auto& slot : slots_) {
+				slot.spell = nullptr;
+				slot.effects.clear();
+			}
+
+			if (actor != builtFor_) {
+				unsubscribe();
+			}
+
+			// Starts listening for the actor. Deltas already queued are kept and replayed after
+			// the walk, so nothing that lands while walking is lost; replay is idempotent.
+			const Key key = Traits::KeyOf(actor);
+			{
+				const std::scoped_lock lock{ pendingMtx_ };
+				auto& queue = pending_[key];
+				if (queue.overflowed) {
+					queue.deltas.clear();
+					queue.overflowed = false;
+				}
+			}
+			removedFrom_.clear();
+
+			// Snapshot the generation before walking so an event landing mid-walk forces another pass
+			builtGeneration_ = generation_.load(std::memory_order_relaxed);
+			builtFor_ = actor;
+			builtForKey_ = key;
+			subscribed_ = true;
+			context_ = Traits::ContextFor(actor);
+
+			Traits::ForEachEffect(actor, [&](Effect* e) {
+				index(e);
+				return true;
+			});
+
+			applyDeltas(actor);
+		}
+
+		// False when the queue overflowed
+		bool applyDeltas(Actor* actor)
+		{
+			{
+				const Key key = Traits::KeyOf(actor);
+				const std::scoped_lock lock{ pendingMtx_ };
+				auto& queue = pending_[key];
+				if (queue.overflowed) {
+					return false;
+				}
+				if (key == Traits::WatchedKey()) {
+					hasPending_.store(false, std::memory_order_relaxed);
+				}
+				if (queue.deltas.empty()) {
+					return true;
+				}
+				draining_.swap(queue.deltas);
+			}
+
+			appliedIDs_.clear();
+			for (const auto& delta : draining_) {
+				// Removals never dereference the stored effect; it may already be freed
+				for (auto& slot : slots_) {
+					if (slot.effects.erase(delta.uniqueID)) {
+						if (std::ranges::find(removedFrom_, slot.spell) == removedFrom_.end()) {
+							removedFrom_.push_back(slot.spell);
+						}
+						break;
+					}
+				}
+
+				std::erase(appliedIDs_, delta.uniqueID);
+				if (delta.applied) {
+					appliedIDs_.push_back(delta.uniqueID);
+				}
+			}
+			draining_.clear();
+
+			// One walk resolves every new effect; only those are classified
+			if (!appliedIDs_.empty()) {
+				Traits::ForEachEffect(actor, [&](Effect* e) {
+					const auto id = Traits::IdOf(e);
+					if (std::ranges::find(appliedIDs_, id) == appliedIDs_.end()) {
+						return true;
+					}
+					index(e);
+					std::erase(appliedIDs_, id);
+					return !appliedIDs_.empty();
+				});
+			}
+			return true;
+		}
+
+		void unsubscribe()
+		{
+			if (!subscribed_) {
+				return;
+			}
+
+			const std::scoped_lock lock{ pendingMtx_ };
+			pending_.erase(builtForKey_);
+			subscribed_ = false;
+		}
+
+		void index(Effect* e)
+		{
+			const auto id = Traits::IdOf(e);
+
+			// A replayed delta may name an effect the walk already indexed
+			for (const auto& slot : slots_) {
+				if (slot.effects.contains(id)) {
+					return;
+				}
+			}
+
+			const auto [spell, pinned] = Traits::Classify(context_, e);
+			if (!spell) {
+				return;
+			}
+			if (pinned) {
+				Traits::Pin(e);
+			}
+			slotFor(spell, pinned).effects.push(e, id);
+		}
+
+		Slot& slotFor(Spell* spell, bool pinned)
+		{
+			Slot* free = nullptr;
+			for (auto& slot : slots_) {
+				if (slot.spell == spell) {
+					return slot;
+				}
+				if (!free && slot.effects.empty()) {
+					free = &slot;
+				}
+			}
+
+			if (!free) {
+				free = &slots_.emplace_back();
+			}
+
+			free->spell = spell;
+			free->pinned = pinned;
+			free->effects.clear();
+			return *free;
+		}
+
+		static inline std::atomic<std::uint32_t> generation_{ 1 };
+		static inline std::mutex pendingMtx_;
+		static inline std::unordered_map<Key, DeltaQueue> pending_{};  // keyed by the indexed actor
+		static inline std::atomic<bool> hasPending_{ false };
+
+		std::vector<Slot> slots_{};
+		std::vector<Delta> draining_{};
+		std::vector<std::uint16_t> appliedIDs_{};
+		std::vector<Spell*> removedFrom_{};
+		Actor* builtFor_{ nullptr };
+		Key builtForKey_{};  // key of this index's delta queue; builtFor_ may be gone by Clear()
+		bool subscribed_{ false };
+		typename Traits::Context context_{};
+		std::uint32_t builtGeneration_{ 0 };
+		std::size_t rebuilds_{ 0 };
+	};
+
+	// ===== Timing wheel ==========================================================
+
+	// Hashed timing wheel with a fixed tick. Frames that cross no tick boundary cost one
+	// add and compare; delays past the horizon clamp to it.
+	template <class T, std::size_t WheelSize>
+	class TimingWheel
+	{
+	public:
+		static constexpr std::size_t kWheelSize = WheelSize;
+
+		explicit TimingWheel(float tickSeconds) noexcept :
+			tick_(tickSeconds)
+		{}
+
+		std::size_t pending() const noexcept { return scheduled_; }
+
+		void Schedule(const T& item, float delaySeconds)
+		{
+			const auto ticks = std::clamp<std::size_t>(
+				static_cast<std::size_t>(std::ceil(delaySeconds / tick_)), 1, kWheelSize - 1);
+
+			buckets_[(cursor_ + ticks) % kWheelSize].push_back(item);
+			++scheduled_;
+		}
+
+		// Appends every item whose deadline passed to `due`
+		void Advance(float deltaSeconds, std::vector<T>& due)
+		{
+			if (scheduled_ == 0) {
+				accumulated_ = 0.0f;
+				return;
+			}
+
+			accumulated_ += deltaSeconds;
+			if (accumulated_ < tick_) {
+				return;
+			}
+
+			// A long hitch can at most sweep the wheel once
+			std::size_t steps = static_cast<std::size_t>(accumulated_ / tick_);
+			accumulated_ -= static_cast<float>(steps) * tick_;
+			steps = (std::min)(steps, kWheelSize);
+
+			for (std::size_t i = 0; i < steps && scheduled_ > 0; ++i) {
+				cursor_ = (cursor_ + 1) % kWheelSize;
+
+				auto& bucket = buckets_[cursor_];
+				if (bucket.empty()) {
+					continue;
+				}
+
+				due.insert(due.end(), bucket.begin(), bucket.end());
+				scheduled_ -= bucket.size();
+				bucket.clear();
+			}
+		}
+
+		// Drops every scheduled item matching `pred`; returns how many were dropped
+		template <class Pred>
+		std::size_t EraseIf(Pred pred)
+		{
+			std::size_t erased = 0;
+			for (auto& bucket : buckets_) {
+				erased += static_cast<std::size_t>(std::erase_if(bucket, pred));
+			}
+			scheduled_ -= erased;
+			return erased;
+		}
+
+		void Clear()
+		{
+			for (auto& bucket : buckets_) {
+				bucket.clear();
+			}
+			scheduled_ = 0;
+			accumulated_ = 0.0f;
+		}
+
+	private:
+		std::array<std::vector<T>, kWheelSize> buckets_{};
+		std::size_t cursor_{ 0 };
+		std::size_t scheduled_{ 0 };
+		float tick_;
+		float accumulated_{ 0.0f };
+	};
+
+	// ===== Supervisor loop =======================================================
+
+	// Scheduling half of the upkeep supervisor: one timing wheel of (actor, entry) checks for
+	// every supervised actor, a FIFO of event-flagged entries of slot 0, an optional per-frame
+	// budget whose leftovers carry over, and parking of actors that cannot be validated.
+	// Checks carry their actor's epoch; bumping it drops every check still queued.
+	//
+	// Traits adapts the engine, all static:
+	//   Handle, Slot, Live                        entry handle, per-actor state, resolved actor
+	//   float kTickSeconds; std::size_t kWheelSize
+	//   Live Resolve(std::uint16_t, Slot&)        falsy when the actor cannot be validated now
+	//   bool Validate(Slot&, Live, Handle)        false when the handle no longer resolves
+	//   void Sweep(Slot&, Live)                   removes what this pass marked invalid
+	//   bool Holds(const Slot&, Handle)
+	//   float CadenceOf(const Slot&, Handle)
+	//   void ForEachEntry(const Slot&, fn)        fn(Handle, float cadence) per registered entry
+	//   void Parked(const Slot&)                  notification only
+	//   PassProbe                                 RAII type constructed around each busy pass
+	template <class Traits>
+	class SupervisorLoop
+	{
+	public:
+		using Handle = typename Traits::Handle;
+		using Slot = typename Traits::Slot;
+		using Live = typename Traits::Live;
+
+		struct Check
+		{
+			std::uint16_t actor{ 0 };  // slot index; 0 is the player
+			std::uint16_t epoch{ 0 };  // slot epoch at scheduling time; older checks are dropped
+			Handle handle{};
+		};
+
+		struct Budget
+		{
+			bool enabled{ false };
+			std::size_t entries{ 1 };
+			std::chrono::microseconds time{ 0 };  // zero or less: entries only
+		};
+
+		std::size_t size() const noexcept { return slots_.size(); }
+		bool empty() const noexcept { return slots_.empty(); }
+		Slot& operator[](std::size_t slot) noexcept { return slots_[slot].state; }
+		const Slot& operator[](std::size_t slot) const noexcept { return slots_[slot].state; }
+
+		bool parked(std::size_t slot) const noexcept { return slots_[slot].parked; }
+		// Any thread
+		std::uint32_t parkedCount() const noexcept { return parkedCount_.load(std::memory_order_relaxed); }
+
+		// Pending checks on the wheel, excluding carried-over and event-flagged ones
+		std::size_t pending() const noexcept { return wheel_.pending(); }
+
+		std::uint16_t Add()
+		{
+			slots_.emplace_back();
+			return static_cast<std::uint16_t>(slots_.size() - 1);
+		}
+
+		void Schedule(std::uint16_t slot, Handle handle, float delaySeconds)
+		{
+			if (handle) {
+				wheel_.Schedule({ slot, slots_[slot].epoch, handle }, delaySeconds);
+			}
+		}
+
+		// Restarts every cadence of one actor and unparks it; checks under the old epoch drop out
+		void Reschedule(std::uint16_t slot)
+		{
+			auto& entry = slots_[slot];
+			++entry.epoch;
+			if (entry.parked) {
+				entry.parked = false;
+				parkedCount_.fetch_sub(1, std::memory_order_relaxed);
+			}
+
+			Traits::ForEachEntry(entry.state, [&](Handle handle, float cadence) { Schedule(slot, handle, cadence); });
+		}
+
+		// Drops every pending check of an actor until Reschedule(); slot 0 is never parked
+		void Park(std::uint16_t slot)
+		{
+			auto& entry = slots_[slot];
+			if (slot == 0 || entry.parked) {
+				return;
+			}
+			++entry.epoch;
+			entry.parked = true;
+			parkedCount_.fetch_add(1, std::memory_order_relaxed);
+			Traits::Parked(entry.state);
+		}
+
+		// Drops every queued check for an entry that is being removed
+		void Forget(std::uint16_t slot, Handle handle)
+		{
+			wheel_.EraseIf([&](const Check& check) { return check.actor == slot && check.handle == handle; });
+
+			// A pass may be walking these queues by index, so blank the checks in place;
+			// an invalid handle never resolves and is dropped when it comes up
+			for (auto& check : due_) {
+				if (check.actor == slot && check.handle == handle) {
+					check.handle = {};
+				}
+			}
+			if (slot == 0) {
+				std::ranges::replace(immediate_, handle, Handle{});
+			}
+		}
+
+		// Validates a slot 0 entry on the next pass, ahead of the wheel
+		void RequestCheck(Handle handle)
+		{
+			if (handle && std::ranges::find(immediate_, handle) == immediate_.end()) {
+				immediate_.push_back(handle);
+			}
+		}
+
+		// Slot 0 was just validated in full
+		void ClearRequests() noexcept { immediate_.clear(); }
+
+		void Clear()
+		{
+			slots_.clear();
+			wheel_.Clear();
+			due_.clear();
+			immediate_.clear();
+			parkedCount_.store(0, std::memory_order_relaxed);
+		}
+
+		// Validates the event-flagged entries, then every check whose cadence passed. Each
+		// actor is resolved once per pass and swept once after its checks; survivors go back
+		// on the wheel and the checks of an actor that failed to resolve park it.
+		void Pass(float deltaSeconds, const Budget& budget)
+		{
+			wheel_.Advance(deltaSeconds, due_);
+			if (due_.empty() && immediate_.empty()) {
+				return;
+			}
+
+			[[maybe_unused]] const typename Traits::PassProbe probe{};
+
+			const auto prepare = [&](std::uint16_t slot) -> Entry& {
+				auto& entry = slots_[slot];
+				if (!entry.visited) {
+					entry.visited = true;
+					visited_.push_back(slot);
+					entry.live = Traits::Resolve(slot, entry.state);
+				}
+				return entry;
+			};
+
+			// Both queues are FIFO so leftovers resume where this pass stopped
+			const auto budgetStart = std::chrono::steady_clock::now();
+			const auto budgetEntries = (std::max)(budget.entries, std::size_t{ 1 });
+			std::size_t processed = 0;
+
+			const auto withinBudget = [&]() {
+				if (!budget.enabled) {
+					return true;
+				}
+				if (processed >= budgetEntries) {
+					return false;
+				}
+				return budget.time.count() <= 0 || std::chrono::steady_clock::now() - budgetStart < budget.time;
+			};
+
+			std::size_t immediateDone = 0;
+			for (; immediateDone < immediate_.size() && withinBudget(); ++immediateDone) {
+				const auto handle = immediate_[immediateDone];
+				auto& entry = prepare(0);
+				if (entry.live && Traits::Validate(entry.state, entry.live, handle)) {
+					++processed;
+				}
+			}
+
+			std::size_t dueDone = 0;
+			for (; dueDone < due_.size() && withinBudget(); ++dueDone) {
+				const auto& check = due_[dueDone];
+				if (!current(check)) {
+					continue;
+				}
+
+				// The first check of an actor that fails to resolve parks it; the rest go stale
+				auto& entry = prepare(check.actor);
+				if (entry.live && Traits::Validate(entry.state, entry.live, check.handle)) {
+					++processed;
+				}
+			}
+
+			for (const auto slot : visited_) {
+				auto& entry = slots_[slot];
+				if (entry.live) {
+					Traits::Sweep(entry.state, entry.live);
+				}
+			}
+
+			// Swept entries now hold stale handles and drop out here
+			for (std::size_t i = 0; i < dueDone; ++i) {
+				const auto check = due_[i];
+				if (!current(check)) {
+					continue;
+				}
+
+				const auto& entry = slots_[check.actor];
+				if (!entry.live) {
+					Park(check.actor);
+				} else if (Traits::Holds(entry.state, check.handle)) {
+					wheel_.Schedule(check, Traits::CadenceOf(entry.state, check.handle));
+				}
+			}
+
+			for (const auto slot : visited_) {
+				slots_[slot].visited = false;
+				slots_[slot].live = Live{};
+			}
+			visited_.clear();
+
+			immediate_.erase(immediate_.begin(), immediate_.begin() + static_cast<std::ptrdiff_t>(immediateDone));
+			due_.erase(due_.begin(), due_.begin() + static_cast<std::ptrdiff_t>(dueDone));
+		}
+
+	private:
+		struct Entry
+		{
+			Slot state{};
+			std::uint16_t epoch{ 0 };
+			bool parked{ false };  // nothing on the wheel until Reschedule()
+
+			// Per-pass scratch
+			bool visited{ false };
+			Live live{};
+		};
+
+		bool current(const Check& check) const noexcept
+		{
+			return check.actor < slots_.size() && slots_[check.actor].epoch == check.epoch;
+		}
+
+		std::vector<Entry> slots_{};
+		TimingWheel<Check, Traits::kWheelSize> wheel_{ Traits::kTickSeconds };
+		std::vector<Check> due_{};
+		std::vector<Handle> immediate_{};
+		std::vector<std::uint16_t> visited_{};
+		std::atomic<std::uint32_t> parkedCount_{ 0 };
+	};
+
+	// ===== Deadline queue ========================================================
+
+	// Min-heap of keys ordered by absolute deadline, one live deadline per key. Rescheduling a
+	// key pushes a fresh heap node and leaves the old one to be skipped when it surfaces, so
+	// lookups are O(1) and every change is O(log n).
+	template <class Key, class Hash = std::hash<Key>>
+	class DeadlineQueue
+	{
+	public:
+		std::size_t size() const noexcept { return deadlines_.size(); }
+		bool empty() const noexcept { return deadlines_.empty(); }
+
+		// Earliest live deadline; only meaningful when !empty()
+		double next()
+		{
+			dropStale();
+			return heap_.front().deadline;
+		}
+
+		// Schedules `key`, or moves an existing key's deadline later; never earlier
+		void ScheduleNoEarlier(const Key& key, double deadline)
+		{
+			auto [it, added] = deadlines_.try_emplace(key, deadline);
+			if (!added) {
+				if (deadline <= it->second) {
+					return;
+				}
+				it->second = deadline;
+			}
+			push(key, deadline);
+		}
+
+		void Erase(const Key& key) { deadlines_.erase(key); }
+
+		// Appends every key whose deadline is <= now to `due`, earliest first
+		void PopDue(double now, std::vector<Key>& due)
+		{
+			while (!heap_.empty() && heap_.front().deadline <= now) {
+				const Node node = popFront();
+				if (const auto it = deadlines_.find(node.key); it != deadlines_.end() && it->second == node.deadline) {
+					deadlines_.erase(it);
+					due.push_back(node.key);
+				}
+			}
+		}
+
+		void Clear()
+		{
+			heap_.clear();
+			deadlines_.clear();
+		}
+
+	private:
+		struct Node
+		{
+			double deadline;
+			Key key;
+		};
+
+		static bool later(const Node& a, const Node& b) noexcept { return a.deadline > b.deadline; }
+
+		void push(const Key& key, double deadline)
+		{
+			heap_.push_back({ deadline, key });
+			std::push_heap(heap_.begin(), heap_.end(), later);
+
+			// Superseded nodes are only dropped when they surface; rebuild once they dominate
+			if (heap_.size() > 2 * deadlines_.size() + 64) {
+				compact();
+			}
+		}
+
+		Node popFront()
+		{
+			std::pop_heap(heap_.begin(), heap_.end(), later);
+			Node node = heap_.back();
+			heap_.pop_back();
+			return node;
+		}
+
+		void dropStale()
+		{
+			while (!heap_.empty()) {
+				const auto it = deadlines_.find(heap_.front().key);
+				if (it != deadlines_.end() && it->second == heap_.front().deadline) {
+					return;
+				}
+				popFront();
+			}
+		}
+
+		void compact()
+		{
+			heap_.clear();
+			for (const auto& [key, deadline] : deadlines_) {
+				heap_.push_back({ deadline, key });
+			}
+			std::make_heap(heap_.begin(), heap_.end(), later);
+		}
+
+		std::vector<Node> heap_;
+		std::unordered_map<Key, double, Hash> deadlines_;
+	};
+
+	// Deferred restores on a deadline queue plus a frame guard: a key armed on frame F is not
+	// released before frame F + minFrames, however far a hitch moves the clock
+	template <class Key, class Hash = std::hash<Key>>
+	class RestoreSchedule
+	{
+	public:
+		std::size_t size() const noexcept { return pending_.size(); }
+		bool empty() const noexcept { return pending_.empty(); }
+
+		// Re-arming an armed key only extends its deadline, and restarts its frame guard
+		void Arm(const Key& key, double deadline)
+		{
+			pending_.ScheduleNoEarlier(key, deadline);
+			armedFrame_[key] = frame_;
+		}
+
+		// Starts a frame; call once per update, before PopDue
+		void AdvanceFrame() noexcept { ++frame_; }
+
+		// Appends every key whose deadline passed and whose frame guard elapsed to `due`.
+		// Guarded keys stay pending at `now`.
+		void PopDue(double now, std::uint64_t minFrames, std::vector<Key>& due)
+		{
+			const auto first = due.size();
+			pending_.PopDue(now, due);
+
+			auto out = due.begin() + static_cast<std::ptrdiff_t>(first);
+			for (auto it = out; it != due.end(); ++it) {
+				const auto armed = armedFrame_.find(*it);
+				if (armed != armedFrame_.end()) {
+					if (frame_ < armed->second + minFrames) {
+						pending_.ScheduleNoEarlier(*it, now);
+						continue;
+					}
+					armedFrame_.erase(armed);
+				}
+				*out++ = std::move(*it);
+			}
+			due.erase(out, due.end());
+		}
+
+		void Forget(const Key& key)
+		{
+			pending_.Erase(key);
+			armedFrame_.erase(key);
+		}
+
+		void Clear()
+		{
+			pending_.Clear();
+			armedFrame_.clear();
+		}
+
+	private:
+		DeadlineQueue<Key, Hash> pending_;
+		std::unordered_map<Key, std::uint64_t, Hash> armedFrame_;  // frame of the last Arm
+		std::uint64_t frame_{ 0 };
+	};
+
+	// ===== Latency histogram =====================================================
+
+	// Log-linear latency histogram in nanoseconds: 8 linear sub-buckets per power of two,
+	// so any recorded value is reported within 12.5%. Recording is a pair of relaxed atomics.
+	class LatencyHistogram
+	{
+	public:
+		struct Summary
+		{
+			std::uint64_t count{ 0 };
+			std::uint64_t p50{ 0 };
+			std::uint64_t p95{ 0 };
+			std::uint64_t p99{ 0 };
+			std::uint64_t max{ 0 };
+		};
+
+		void Record(std::uint64_t ns) noexcept
+		{
+			counts_[IndexFor(ns)].fetch_add(1, std::memory_order_relaxed);
+
+			auto prev = max_.load(std::memory_order_relaxed);
+			while (ns > prev && !max_.compare_exchange_weak(prev, ns, std::memory_order_relaxed)) {}
+		}
+
+		Summary SnapshotAndReset() noexcept
+		{
+			std::array<std::uint32_t, kBuckets> snapshot{};
+			Summary out{};
+
+			for (std::size_t i = 0; i < kBuckets; ++i) {
+				snapshot[i] = counts_[i].exchange(0, std::memory_order_relaxed);
+				out.count += snapshot[i];
+			}
+			out.max = max_.exchange(0, std::memory_order_relaxed);
+
+			if (out.count == 0) {
+				return out;
+			}
+
+			const auto rankOf = [&](double q) {
+				return (std::max)(std::uint64_t{ 1 }, static_cast<std::uint64_t>(std::ceil(q * static_cast<double>(out.count))));
+			};
+			const std::uint64_t r50 = rankOf(0.50);
+			const std::uint64_t r95 = rankOf(0.95);
+			const std::uint64_t r99 = rankOf(0.99);
+
+			std::uint64_t seen = 0;
+			for (std::size_t i = 0; i < kBuckets; ++i) {
+				if (snapshot[i] == 0) {
+					continue;
+				}
+				seen += snapshot[i];
+
+				const auto bound = (std::min)(UpperBoundOf(i), out.max);
+				if (out.p50 == 0 && seen >= r50) {
+					out.p50 = bound;
+				}
+				if (out.p95 == 0 && seen >= r95) {
+					out.p95 = bound;
+				}
+				if (out.p99 == 0 && seen >= r99) {
+					out.p99 = bound;
+					break;
+				}
+			}
+			return out;
+		}
+
+	private:
+		static constexpr std::size_t kSubBits = 3;
+		static constexpr std::size_t kSubBuckets = 1 << kSubBits;
+		static constexpr std::size_t kMajors = 40;  // covers ~2^42 ns; larger values clamp
+		static constexpr std::size_t kBuckets = kMajors * kSubBuckets;
+
+		static std::size_t IndexFor(std::uint64_t ns) noexcept
+		{
+			if (ns < kSubBuckets) {
+				return static_cast<std::size_t>(ns);
+			}
+
+			// Top kSubBits+1 bits select (major, sub); everything below is precision we drop
+			const auto shift = static_cast<std::size_t>(std::bit_width(ns)) - 1 - kSubBits;
+			const auto sub = static_cast<std::size_t>(ns >> shift) & (kSubBuckets - 1);
+			return (std::min)((shift + 1) * kSubBuckets + sub, kBuckets - 1);
+		}
+
+		static std::uint64_t UpperBoundOf(std::size_t index) noexcept
+		{
+			if (index < kSubBuckets) {
+				return index;
+			}
+
+			const auto shift = index / kSubBuckets - 1;
+			const auto sub = index % kSubBuckets;
+			return ((kSubBuckets + sub + 1) << shift) - 1;
+		}
+
+		std::array<std::atomic<std::uint32_t>, kBuckets> counts_{};
+		std::atomic<std::uint64_t> max_{ 0 };
+	};
+
+	// ===== Upkeep pricing ========================================================
+
+	namespace UpkeepPricing
+	{
+		// out[i] = pow(base[i], exponent); out may alias base
+		inline void PowBatch(std::span<const float> base, float exponent, std::span<float> out) noexcept
+		{
+			std::size_t i = 0;
+#if defined(_MSC_VER) && defined(MAINT_CORE_X64)
+			// SVML; four lanes per call
+			const __m128 e = _mm_set1_ps(exponent);
+			for (; i + 4 <= base.size(); i += 4) {
+				_mm_storeu_ps(out.data() + i, _mm_pow_ps(_mm_loadu_ps(base.data() + i), e));
+			}
+#endif
+			for (; i < base.size(); ++i) {
+				out[i] = std::pow(base[i], exponent);
+			}
+		}
+
+		// out[i] = upkeep for (baseCosts[i], durations[i]). A spell lasting `neutral` seconds
+		// pays its base cost; shorter ones pay more, longer ones less, scaled by `exponent`.
+		// A duration of 0 (unknown) is priced as neutral; neutral <= 0 disables the scaling.
+		inline void PriceBatch(
+			std::span<const float> baseCosts,
+			std::span<const float> durations,
+			float neutral,
+			float exponent,
+			float regenMultiplier,
+			std::span<float> out) noexcept
+		{
+			const std::size_t n = baseCosts.size();
+
+			if (neutral <= 0.0f) {
+				for (std::size_t i = 0; i < n; ++i) {
+					out[i] = baseCosts[i] > 0.0f ? std::round(baseCosts[i]) : 0.0f;
+				}
+				return;
+			}
+
+			// ratio > 1 => short spell => punishing; ratio < 1 => long spell => cheaper
+			for (std::size_t i = 0; i < n; ++i) {
+				out[i] = neutral / (durations[i] > 0.0f ? durations[i] : neutral);
+			}
+			PowBatch(out.first(n), exponent, out.first(n));
+
+			for (std::size_t i = 0; i < n; ++i) {
+				out[i] = baseCosts[i] > 0.0f ?
+				             (std::max)(1.0f, std::round(baseCosts[i] * out[i] * regenMultiplier)) :
+				             0.0f;
+			}
+		}
+	}
+
+	// ===== Binary reading ========================================================
+
+	// CRC-32C (Castagnoli), reflected, table-driven
+	namespace detail
+	{
+		constexpr std::array<std::uint32_t, 256> MakeCrc32cTable() noexcept
+		{
+			std::array<std::uint32_t, 256> table{};
+			for (std::uint32_t i = 0; i < 256; ++i) {
+				std::uint32_t crc = i;
+				for (int bit = 0; bit < 8; ++bit) {
+					crc = (crc >> 1) ^ ((crc & 1u) ? 0x82F63B78u : 0u);
+				}
+				table[i] = crc;
+			}
+			return table;
+		}
+
+		inline constexpr auto kCrc32cTable = MakeCrc32cTable();
+	}
+
+	inline std::uint32_t Crc32c(std::span<const std::byte> data, std::uint32_t crc = 0) noexcept
+	{
+		crc = ~crc;
+		for (const auto b : data) {
+			crc = detail::kCrc32cTable[(crc ^ static_cast<std::uint8_t>(b)) & 0xFF] ^ (crc >> 8);
+		}
+		return ~crc;
+	}
+
+	// Cursor over a byte span that never reads past the end. The first short read
+	// latches a failure; every later read fails too, so callers can check once.
+	class SpanReader
+	{
+	public:
+		explicit SpanReader(std::span<const std::byte> data) noexcept :
+			data_(data)
+		{}
+
+		bool ok() const noexcept { return ok_; }
+		std::size_t offset() const noexcept { return cursor_; }
+		std::size_t remaining() const noexcept { return data_.size() - cursor_; }
+
+		template <class T>
+		bool Read(T& out) noexcept
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+
+			const auto bytes = Take(sizeof(T));
+			if (bytes.empty()) {
+				return false;
+			}
+			std::memcpy(&out, bytes.data(), sizeof(T));
+			return true;
+		}
+
+		// View of the next n bytes; empty (and failed) if fewer remain
+		std::span<const std::byte> Take(std::size_t n) noexcept
+		{
+			if (!ok_ || n > remaining()) {
+				ok_ = false;
+				return {};
+			}
+
+			const auto out = data_.subspan(cursor_, n);
+			cursor_ += n;
+			return out;
+		}
+
+		std::string_view TakeString(std::size_t n) noexcept
+		{
+			const auto bytes = Take(n);
+			return { reinterpret_cast<const char*>(bytes.data()), bytes.size() };
+		}
+
+	private:
+		std::span<const std::byte> data_;
+		std::size_t cursor_{ 0 };
+		bool ok_{ true };
+	};
+
+	// ===== SKSE co-save directory ================================================
+
+	// An SKSE co-save is a file header, then per plugin a header and its chunks, each
+	// chunk a header followed by its data. Walking it touches only the headers.
+	namespace CosaveDirectory
+	{
+		struct FileHeader
+		{
+			char signature[4];  // "SKSE"
+			std::uint32_t formatVersion;
+			std::uint32_t skseVersion;
+			std::uint32_t runtimeVersion;
+			std::uint32_t numPlugins;
+		};
+
+		struct PluginHeader
+		{
+			std::uint32_t uid;
+			std::uint32_t numChunks;
+			std::uint32_t length;  // chunk headers + data
+		};
+
+		struct ChunkHeader
+		{
+			std::uint32_t type;
+			std::uint32_t version;
+			std::uint32_t length;
+		};
+
+		enum class Status : std::uint8_t
+		{
+			kFound,
+			kNotFound,   // the directory is intact but holds no accepted chunk
+			kNotCosave,  // no SKSE file header
+			kTruncated,  // a plugin block runs past the end of the data
+		};
+
+		struct Lookup
+		{
+			Status status{ Status::kNotFound };
+			std::span<const std::byte> chunk;  // kFound: the chunk's data, bounded by its length
+			std::uint32_t rejected{ 0 };       // chunks of the plugin that were cut short or refused
+		};
+
+		// First chunk of `type` in any block of plugin `uid` whose data passes accept(data).
+		// A damaged chunk list only ends the search inside its own block, which the plugin
+		// header still bounds.
+		template <class Accept>
+		Lookup FindChunk(std::span<const std::byte> data, std::uint32_t uid, std::uint32_t type, Accept&& accept)
+		{
+			Lookup result;
+			SpanReader in{ data };
+			FileHeader file{};
+			if (!in.Read(file) || std::memcmp(file.signature, "SKSE", 4) != 0) {
+				result.status = Status::kNotCosave;
+				return result;
+			}
+
+			for (std::uint32_t p = 0; p < file.numPlugins; ++p) {
+				PluginHeader plugin{};
+				if (!in.Read(plugin) || plugin.length > in.remaining()) {
+					result.status = Status::kTruncated;
+					return result;
+				}
+
+				const auto block = in.Take(plugin.length);
+				if (plugin.uid != uid) {
+					continue;
+				}
+
+				SpanReader chunks{ block };
+				for (std::uint32_t c = 0; c < plugin.numChunks; ++c) {
+					ChunkHeader chunk{};
+					if (!chunks.Read(chunk) || chunk.length > chunks.remaining()) {
+						++result.rejected;
+						break;
+					}
+
+					const auto body = chunks.Take(chunk.length);
+					if (chunk.type != type) {
+						continue;
+					}
+					if (accept(body)) {
+						result.status = Status::kFound;
+						result.chunk = body;
+						return result;
+					}
+					++result.rejected;
+				}
+			}
+			return result;
+		}
+	}
+
+	// ===== Byte pattern search ===================================================
+
+	// First occurrence of a fixed needle (at least 2 bytes) in a byte range. The vector
+	// kernels compare the needle's first and last bytes at 16/32 offsets per step and only
+	// memcmp the middle where both match. Offsets in [from, limit) are candidate starts;
+	// the caller guarantees limit + needle.size() - 1 <= data.size().
+	namespace PatternSearch
+	{
+		// Each returns the first match in [from, limit), or limit
+		using SearchFn = std::size_t (*)(std::span<const std::byte> data, std::size_t from, std::size_t limit, std::string_view needle);
+
+		inline bool MiddleMatches(const std::byte* at, std::string_view needle) noexcept
+		{
+			return std::memcmp(at + 1, needle.data() + 1, needle.size() - 2) == 0;
+		}
+
+		inline std::size_t Scalar(std::span<const std::byte> data, std::size_t from, std::size_t limit, std::string_view needle) noexcept
+		{
+			const auto lastIndex = needle.size() - 1;
+			const auto first = static_cast<std::byte>(needle.front());
+			const auto last = static_cast<std::byte>(needle.back());
+
+			for (std::size_t i = from; i < limit; ++i) {
+				if (data[i] == first && data[i + lastIndex] == last && MiddleMatches(data.data() + i, needle)) {
+					return i;
+				}
+			}
+			return limit;
+		}
+
+#if defined(MAINT_CORE_X64)
+		inline std::size_t SSE2(std::span<const std::byte> data, std::size_t from, std::size_t limit, std::string_view needle) noexcept
+		{
+			const auto lastIndex = needle.size() - 1;
+			const __m128i first = _mm_set1_epi8(needle.front());
+			const __m128i last = _mm_set1_epi8(needle.back());
+			const auto* bytes = data.data();
+
+			std::size_t i = from;
+			for (; i + 16 <= limit; i += 16) {
+				const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+				const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i + lastIndex));
+
+				auto mask = static_cast<std::uint32_t>(
+					_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last))));
+				while (mask) {
+					const auto at = i + static_cast<std::size_t>(std::countr_zero(mask));
+					if (MiddleMatches(bytes + at, needle)) {
+						return at;
+					}
+					mask &= mask - 1;
+				}
+			}
+			return Scalar(data, i, limit, needle);
+		}
+
+		MAINT_TARGET_AVX2 inline std::size_t AVX2(std::span<const std::byte> data, std::size_t from, std::size_t limit, std::string_view needle) noexcept
+		{
+			const auto lastIndex = needle.size() - 1;
+			const __m256i first = _mm256_set1_epi8(needle.front());
+			const __m256i last = _mm256_set1_epi8(needle.back());
+			const auto* bytes = data.data();
+
+			std::size_t i = from;
+			for (; i + 32 <= limit; i += 32) {
+				const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + i));
+				const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + i + lastIndex));
+
+				auto mask = static_cast<std::uint32_t>(
+					_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last))));
+				while (mask) {
+					const auto at = i + static_cast<std::size_t>(std::countr_zero(mask));
+					if (MiddleMatches(bytes + at, needle)) {
+						return at;
+					}
+					mask &= mask - 1;
+				}
+			}
+			return SSE2(data, i, limit, needle);
+		}
+
+		inline bool CPUHasAVX2() noexcept
+		{
+#	if defined(_MSC_VER)
+			int regs[4]{};
+			__cpuid(regs, 0);
+			if (regs[0] < 7) {
+				return false;
+			}
+
+			// AVX must be usable by the OS (OSXSAVE + YMM state enabled) before AVX2 counts
+			__cpuid(regs, 1);
+			constexpr int kOSXSAVE = 1 << 27;
+			constexpr int kAVX = 1 << 28;
+			if ((regs[2] & kOSXSAVE) == 0 || (regs[2] & kAVX) == 0 || (_xgetbv(0) & 0x6) != 0x6) {
+				return false;
+			}
+
+			__cpuidex(regs, 7, 0);
+			constexpr int kAVX2 = 1 << 5;
+			return (regs[1] & kAVX2) != 0;
+#	else
+			// Checks OS support for the YMM state as well
+			return __builtin_cpu_supports("avx2");
+#	endif
+		}
+#endif
+
+		// Widest kernel this CPU runs; SSE2 is baseline on x64
+		inline SearchFn Select() noexcept
+		{
+#if defined(MAINT_CORE_X64)
+			static const SearchFn fn = CPUHasAVX2() ? &AVX2 : &SSE2;
+			return fn;
+#else
+			return &Scalar;
+#endif
+		}
+
+		inline std::string_view NameOf(SearchFn fn) noexcept
+		{
+#if defined(MAINT_CORE_X64)
+			if (fn == &AVX2) {
+				return "AVX2";
+			}
+			if (fn == &SSE2) {
+				return "SSE2";
+			}
+#endif
+			return "scalar";
+		}
+	}
+}  // namespace Maint::Core
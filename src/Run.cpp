@@ -1,11 +1,17 @@
 #include "Run.hpp"
 
 #include <algorithm>
+#include <bit>
 #include <cmath>
+#include <execution>
 #include <format>
+#include <future>
+#include <immintrin.h>
+#include <intrin.h>
 #include <numeric>
 #include <ranges>
 #include <set>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -43,6 +49,24 @@ namespace Maint
 		{
 			return s && s->data.delivery == RE::MagicSystem::Delivery::kSelf;
 		}
+
+		// Drop a single script-added form, leaving the rest of the list untouched
+		inline void RemoveAddedForm(RE::BGSListForm* list, const RE::TESForm* form)
+		{
+			if (!list || !form || !list->scriptAddedTempForms) {
+				return;
+			}
+
+			auto& added = *list->scriptAddedTempForms;
+			const auto formID = form->GetFormID();
+			for (auto it = added.begin(); it != added.end(); ++it) {
+				if (*it == formID) {
+					added.erase(it);
+					--list->scriptAddedFormCount;
+					return;
+				}
+			}
+		}
 	}  // namespace
 
 	// ================= CONFIG::ConfigBase ========================================
@@ -112,6 +136,62 @@ namespace Maint
 	}
 	void Config::ConfigBase::Save() { ini_.SaveFile(path_.c_str()); }
 
+	// ================= Instrumentation ===========================================
+
+#if MAINT_PROFILING
+	void Profiler::Record(Probe probe, std::uint64_t ns) noexcept
+	{
+		histograms_[static_cast<std::size_t>(probe)].Record(ns);
+	}
+
+	void Profiler::Dump()
+	{
+		static constexpr std::array<const char*, static_cast<std::size_t>(Probe::kTotal)> kNames{
+			"UpdatePCMod",
+			"ValidateScheduled",
+			"ForceMaintainedSpellUpdate",
+			"MaintainedEffectsCache::rebuild",
+			"UpkeepCostCalculator::Calculate",
+			"MaintainSpell",
+			"OnPreLoadGame_ScanCosave",
+			"MCMEventSink",
+			"RepriceUpkeep"
+		};
+
+		spdlog::info("[Probes] ---- window ({:.0f}s) ----", sinceDump_);
+		for (std::size_t i = 0; i < histograms_.size(); ++i) {
+			const auto summary = histograms_[i].SnapshotAndReset();
+			if (summary.count == 0) {
+				continue;
+			}
+
+			spdlog::info(
+				"[Probes] {}: n={} p50={:.3f}ms p95={:.3f}ms p99={:.3f}ms max={:.3f}ms",
+				kNames[i],
+				summary.count,
+				summary.p50 / 1e6,
+				summary.p95 / 1e6,
+				summary.p99 / 1e6,
+				summary.max / 1e6);
+		}
+		sinceDump_ = 0.0f;
+	}
+
+	void Profiler::RequestDump() noexcept
+	{
+		dumpRequested_.store(true, std::memory_order_relaxed);
+	}
+
+	void Profiler::Tick(float deltaSeconds)
+	{
+		sinceDump_ += deltaSeconds;
+		const bool requested = dumpRequested_.exchange(false, std::memory_order_relaxed);
+		if (requested || (Config::ProbeDumpInterval > 0.0f && sinceDump_ >= Config::ProbeDumpInterval)) {
+			Dump();
+		}
+	}
+#endif
+
 	// ===== Heart of Magic handler ================================================
 
 	void HeartofMagic_Handler::GrantXPForMaintainedSpell(RE::SpellItem* spell)
@@ -207,42 +287,108 @@ namespace Maint
 		return r;
 	}
 
+	MaintainedRegistry* MaintainedRegistry::Find(RE::Actor* actor)
+	{
+		if (!actor) {
+			return nullptr;
+		}
+		if (actor->IsPlayerRef()) {
+			return &Get();
+		}
+
+		const auto handle = actor->GetHandle();
+		for (auto& [owner, registry] : npcs_) {
+			if (owner == handle) {
+				return registry.get();
+			}
+		}
+		return nullptr;
+	}
+
+	MaintainedRegistry& MaintainedRegistry::Acquire(RE::Actor* actor)
+	{
+		if (auto* registry = Find(actor)) {
+			return *registry;
+		}
+
+		spdlog::info("Tracking maintained spells for {} (0x{:08X})", actor->GetName(), actor->GetFormID());
+		return *npcs_.emplace_back(actor->GetHandle(), std::make_unique<MaintainedRegistry>()).second;
+	}
+
+	void MaintainedRegistry::ClearNPCs()
+	{
+		npcs_.clear();
+		MaintainedEffectsCache::Invalidate();
+	}
+
 	// ===============================
 	// Maintained spell tracking
 	// ===============================
 	void MaintainedRegistry::clear()
 	{
-		map_.clear();
+		table_.Clear();
 		deferred_.clear();
+		MaintainedEffectsCache::Invalidate();
 	}
 
 	bool MaintainedRegistry::empty()
 	{
-		return map_.empty() && deferred_.empty();
+		return table_.empty() && deferred_.empty();
 	}
 
 	bool MaintainedRegistry::hasBase(RE::SpellItem* base)
 	{
-		return base && map_.contains(base);
+		return base && table_.IndexOf(base) >= 0;
 	}
 
-	Domain::MaintainedPair* MaintainedRegistry::getByBase(RE::SpellItem* base)
+	MaintainedRegistry::Handle MaintainedRegistry::find(RE::SpellItem* base) const
 	{
-		if (!base) {
-			return nullptr;
+		return base ? table_.Find(base) : Handle{};
+	}
+
+	Domain::MaintainedPair* MaintainedRegistry::get(Handle handle)
+	{
+		const auto index = table_.Resolve(handle);
+		return index >= 0 ? &table_.column<kPair>()[index] : nullptr;
+	}
+
+	RE::SpellItem* MaintainedRegistry::baseOf(Handle handle) const
+	{
+		const auto index = table_.Resolve(handle);
+		return index >= 0 ? table_.keys()[index] : nullptr;
+	}
+
+	MaintainedRegistry::Handle MaintainedRegistry::findByMaintained(const RE::SpellItem* maintained) const
+	{
+		if (!maintained) {
+			return {};
 		}
 
-		auto it = map_.find(base);
-		return it != map_.end() ? &it->second : nullptr;
+		const auto pairs = table_.column<kPair>();
+		for (std::size_t i = 0; i < pairs.size(); ++i) {
+			if (pairs[i].infinite == maintained) {
+				return table_.HandleAt(i);
+			}
+		}
+		return {};
 	}
 
-	void MaintainedRegistry::insert(RE::SpellItem* base, Domain::MaintainedPair pair)
+	MaintainedRegistry::Handle MaintainedRegistry::insert(
+		RE::SpellItem* base,
+		Domain::MaintainedPair pair,
+		UpkeepCostCalculator::Inputs upkeep)
 	{
 		if (!base) {
-			return;
+			return {};
+		}
+
+		if (table_.empty()) {
+			table_.reserve(kExpectedEntries);
 		}
 
-		map_[base] = std::move(pair);
+		const auto handle = table_.Insert(base, pair, upkeep.baseCost, upkeep.realDuration);
+		MaintainedEffectsCache::Invalidate();
+		return handle;
 	}
 
 	void MaintainedRegistry::eraseBase(RE::SpellItem* base)
@@ -251,13 +397,15 @@ namespace Maint
 			return;
 		}
 
-		map_.erase(base);
+		if (const auto index = table_.IndexOf(base); index >= 0) {
+			eraseAt(static_cast<std::size_t>(index));
+		}
 	}
 
-	std::unordered_map<RE::SpellItem*, Domain::MaintainedPair>&
-		MaintainedRegistry::map()
+	void MaintainedRegistry::eraseAt(std::size_t index)
 	{
-		return map_;
+		table_.EraseAt(index);
+		MaintainedEffectsCache::Invalidate();
 	}
 
 	// ===============================
@@ -292,10 +440,10 @@ namespace Maint
 		}
 
 		const char* name = spell->GetName();
-		return name && *name && silencedSpells_.contains(name);
+		return name && *name && silencedSpells_.contains(std::string_view{ name });
 	}
 
-	std::unordered_set<std::string>& MaintainedRegistry::silencedSpells()
+	MaintainedRegistry::SpellNameSet& MaintainedRegistry::silencedSpells()
 	{
 		return silencedSpells_;
 	}
@@ -332,168 +480,264 @@ namespace Maint
 
 	// ================= FXSilencer =================================================
 
-	void FXSilencer::SilenceSpellFX(Domain::MaintainedPair& pair)
+	bool FXSilencer::CanSilence(const RE::EffectSetting* base)
 	{
-		if (!pair.infinite || pair.HasSilencedFX()) {
-			return;
-		}
+		using Archetype = RE::EffectSetting::Archetype;
 
-		auto* spell = pair.infinite;
+		// Archetype exclusions (never silence)
+		switch (base->GetArchetype()) {
+		case Archetype::kLight:
+		case Archetype::kBoundWeapon:
+		case Archetype::kDisguise:
+		case Archetype::kSummonCreature:
+		case Archetype::kNightEye:
+		case Archetype::kInvisibility:
+		case Archetype::kGuide:
+		case Archetype::kWerewolf:
+		case Archetype::kWerewolfFeed:
+			return false;
+		default:
+			return true;
+		}
+	}
 
-		using Archetype = RE::EffectSetting::Archetype;
+	void FXSilencer::Acquire(RE::Effect* eff)
+	{
 		using EffectFlag = RE::EffectSetting::EffectSettingData::Flag;
 
-		for (auto* eff : spell->effects) {
-			if (!eff || !eff->baseEffect) {
-				continue;
-			}
-
-			auto* base = eff->baseEffect;
-			auto& data = base->data;
-
-			// ─────────────────────────────────────────────
-			// Archetype exclusions (never silence)
-			// ─────────────────────────────────────────────
-			switch (base->GetArchetype()) {
-			case Archetype::kLight:
-			case Archetype::kBoundWeapon:
-			case Archetype::kDisguise:
-			case Archetype::kSummonCreature:
-			case Archetype::kNightEye:
-			case Archetype::kInvisibility:
-			case Archetype::kGuide:
-			case Archetype::kWerewolf:
-			case Archetype::kWerewolfFeed:
-				spdlog::debug(
-					"{} fx will not be silenced",
-					base->GetName());
-				continue;
-			default:
-				break;
-			}
+		auto* base = eff->baseEffect;
+		auto& data = base->data;
 
-			Domain::SilencedEffect record{};
-			record.effect = eff;
-			record.baseEffect = base;
+		auto [it, first] = effects_.try_emplace(base);
+		auto& entry = it->second;
+		++entry.refs;
 
-			// ─────────────────────────────────────────────
-			// Primary path: FXPersist toggle
-			// ─────────────────────────────────────────────
+		if (first) {
+			// The first spell to silence a setting decides how; later ones only add a reference
 			if (data.flags.any(EffectFlag::kFXPersist)) {
-				record.silenceMode = Domain::FxSilenceMode::kPersistToggle;
-				record.hadFXPersist = true;
-
-				data.flags.reset(EffectFlag::kFXPersist);
+				entry.mode = Domain::FxSilenceMode::kPersistToggle;
+			} else if (data.effectShader) {
+				entry.mode = Domain::FxSilenceMode::kShaderFallback;
+			} else {
+				spdlog::debug("No FX silence path for effect: {}", base->GetName());
+			}
+		}
 
-				// Schedule delayed restore
-				EffectRestorer::Push(eff);
+		switch (entry.mode) {
+		case Domain::FxSilenceMode::kPersistToggle:
+			// Every application needs the flag off; the restorer turns it back on for normal casts
+			data.flags.reset(EffectFlag::kFXPersist);
+			restores_.push_back(eff);
+			spdlog::debug("Silenced FX via persist toggle: {}", base->GetName());
+			break;
 
-				pair.silencedEffects.emplace_back(record);
+		case Domain::FxSilenceMode::kShaderFallback:
+			if (first) {
+				auto* shader = data.effectShader;
+				auto& sdata = shader->data;
 
-				spdlog::debug(
-					"Silenced FX via persist toggle: {}",
-					base->GetName());
+				auto [sit, firstShader] = shaders_.try_emplace(shader);
+				if (firstShader) {
+					// Capture original alpha state
+					sit->second.original = {
+						.fillPersistent = sdata.fillTextureEffectPersistentAlphaRatio,
+						.fillFull = sdata.fillTextureEffectFullAlphaRatio,
+						.edgePersistent = sdata.edgeEffectPersistentAlphaRatio,
+						.edgeFull = sdata.edgeEffectFullAlphaRatio,
+						.valid = true,
+					};
 
-				continue;
+					// Suppress visuals
+					sdata.fillTextureEffectPersistentAlphaRatio = 0.0f;
+					sdata.fillTextureEffectFullAlphaRatio = 0.0f;
+					sdata.edgeEffectPersistentAlphaRatio = 0.0f;
+					sdata.edgeEffectFullAlphaRatio = 0.0f;
+				}
+				++sit->second.refs;
+				spdlog::debug("Silenced FX via shader fallback: {}", base->GetName());
 			}
+			break;
 
-			// ─────────────────────────────────────────────
-			// Fallback path: shader suppression
-			// ─────────────────────────────────────────────
-			if (data.effectShader) {
-				auto* shader = data.effectShader;
+		default:
+			break;
+		}
+	}
+
+	void FXSilencer::Release(RE::EffectSetting* base)
+	{
+		const auto it = effects_.find(base);
+		if (it == effects_.end() || --it->second.refs > 0) {
+			return;
+		}
+
+		// Persist toggles are restored by EffectRestorer; only shader fallbacks need undoing
+		if (it->second.mode == Domain::FxSilenceMode::kShaderFallback) {
+			auto* shader = base->data.effectShader;
+			const auto sit = shaders_.find(shader);
+			if (sit != shaders_.end() && --sit->second.refs == 0) {
+				const auto& original = sit->second.original;
 				auto& sdata = shader->data;
 
-				record.silenceMode = Domain::FxSilenceMode::kShaderFallback;
-				record.shader = shader;
+				// Restore original alpha values
+				sdata.fillTextureEffectPersistentAlphaRatio = original.fillPersistent;
+				sdata.fillTextureEffectFullAlphaRatio = original.fillFull;
+				sdata.edgeEffectPersistentAlphaRatio = original.edgePersistent;
+				sdata.edgeEffectFullAlphaRatio = original.edgeFull;
+
+				spdlog::debug("Restored FX shader visuals for effect: {}", base->GetName());
+				shaders_.erase(sit);
+			}
+		}
+
+		effects_.erase(it);
+	}
 
-				// Capture original alpha state
-				record.shaderAlpha.fillPersistent = sdata.fillTextureEffectPersistentAlphaRatio;
-				record.shaderAlpha.fillFull = sdata.fillTextureEffectFullAlphaRatio;
-				record.shaderAlpha.edgePersistent = sdata.edgeEffectPersistentAlphaRatio;
-				record.shaderAlpha.edgeFull = sdata.edgeEffectFullAlphaRatio;
-				record.shaderAlpha.valid = true;
+	void FXSilencer::SilenceSpellFX(Domain::MaintainedPair& pair)
+	{
+		SilenceEffects(pair);
+		EffectRestorer::PushBatch(restores_);
+		restores_.clear();
+	}
 
-				// Suppress visuals
-				sdata.fillTextureEffectPersistentAlphaRatio = 0.0f;
-				sdata.fillTextureEffectFullAlphaRatio = 0.0f;
-				sdata.edgeEffectPersistentAlphaRatio = 0.0f;
-				sdata.edgeEffectFullAlphaRatio = 0.0f;
+	void FXSilencer::ApplyBatch(
+		std::span<Domain::MaintainedPair* const> silence,
+		std::span<Domain::MaintainedPair* const> unsilence)
+	{
+		// Releases first, so a shader moving between spells is not restored and re-zeroed
+		for (auto* pair : unsilence) {
+			UnsilenceSpellFX(*pair);
+		}
+		for (auto* pair : silence) {
+			SilenceEffects(*pair);
+		}
 
-				pair.silencedEffects.emplace_back(record);
+		EffectRestorer::PushBatch(restores_);
+		restores_.clear();
+	}
 
-				spdlog::debug(
-					"Silenced FX via shader fallback: {}",
-					base->GetName());
+	void FXSilencer::SilenceEffects(Domain::MaintainedPair& pair)
+	{
+		if (!pair.infinite || pair.fxSilenced) {
+			return;
+		}
 
+		for (auto* eff : pair.infinite->effects) {
+			if (!eff || !eff->baseEffect) {
+				continue;
+			}
+			if (!CanSilence(eff->baseEffect)) {
+				spdlog::debug("{} fx will not be silenced", eff->baseEffect->GetName());
 				continue;
 			}
 
-			// ─────────────────────────────────────────────
-			// No viable silence path
-			// ─────────────────────────────────────────────
-			spdlog::debug(
-				"No FX silence path for effect: {}",
-				base->GetName());
+			// A cloned setting belongs to this spell alone; strip its visuals outright
+			if (EffectClonePool::SourceOf(eff)) {
+				auto& data = eff->baseEffect->data;
+				data.flags.reset(RE::EffectSetting::EffectSettingData::Flag::kFXPersist);
+				data.effectShader = nullptr;
+				data.hitEffectArt = nullptr;
+				continue;
+			}
+			Acquire(eff);
 		}
+
+		pair.fxSilenced = true;
 	}
 
 	void FXSilencer::UnsilenceSpellFX(Domain::MaintainedPair& pair)
 	{
-		if (!pair.infinite) {
+		if (!pair.infinite || !pair.fxSilenced) {
 			return;
 		}
 
-		for (auto it = pair.silencedEffects.begin();
-			it != pair.silencedEffects.end();) {
-			auto& record = *it;
-
-			// Only undo shader-fallback silencing
-			if (record.silenceMode != Domain::FxSilenceMode::kShaderFallback) {
-				++it;
+		// Same walk as SilenceSpellFX, so every reference taken there is dropped here
+		for (auto* eff : pair.infinite->effects) {
+			if (!eff || !eff->baseEffect || !CanSilence(eff->baseEffect)) {
 				continue;
 			}
 
-			// Defensive validation
-			if (!record.shader || !record.shaderAlpha.valid) {
-				it = pair.silencedEffects.erase(it);
+			if (const auto* src = EffectClonePool::SourceOf(eff)) {
+				const auto& original = src->baseEffect->data;
+				auto& data = eff->baseEffect->data;
+				if (original.flags.any(RE::EffectSetting::EffectSettingData::Flag::kFXPersist)) {
+					data.flags.set(RE::EffectSetting::EffectSettingData::Flag::kFXPersist);
+				}
+				data.effectShader = original.effectShader;
+				data.hitEffectArt = original.hitEffectArt;
 				continue;
 			}
+			Release(eff->baseEffect);
+		}
 
-			auto& sdata = record.shader->data;
+		pair.fxSilenced = false;
+	}
 
-			// Restore original alpha values
-			sdata.fillTextureEffectPersistentAlphaRatio =
-				record.shaderAlpha.fillPersistent;
-			sdata.fillTextureEffectFullAlphaRatio =
-				record.shaderAlpha.fillFull;
-			sdata.edgeEffectPersistentAlphaRatio =
-				record.shaderAlpha.edgePersistent;
-			sdata.edgeEffectFullAlphaRatio =
-				record.shaderAlpha.edgeFull;
+	void FXSilencer::Clear()
+	{
+		effects_.clear();
+		shaders_.clear();
+		restores_.clear();
+	}
 
-			spdlog::debug(
-				"Restored FX shader visuals for effect: {}",
-				record.baseEffect ? record.baseEffect->GetName() : "<unknown>");
+	// ================= SpellTemplateCache ========================================
 
-			// Remove this record — it has been fully restored
-			it = pair.silencedEffects.erase(it);
+	const SpellTemplateCache::Template& SpellTemplateCache::Get(RE::SpellItem* base)
+	{
+		auto [it, inserted] = templates_.try_emplace(base);
+		if (inserted || it->second.formID != base->GetFormID()) {
+			it->second = Build(base);
 		}
+		return it->second;
+	}
 
-		pair.silencedEffects.clear();
+	const SpellTemplateCache::Template* SpellTemplateCache::Find(const RE::SpellItem* base)
+	{
+		const auto it = templates_.find(base);
+		return it != templates_.end() && it->second.formID == base->GetFormID() ? &it->second : nullptr;
 	}
 
-	// ================= SpellFactory ==============================================
+	void SpellTemplateCache::Invalidate()
+	{
+		if (!templates_.empty()) {
+			spdlog::debug("Dropping {} spell templates", templates_.size());
+		}
+		templates_.clear();
+	}
 
-	RE::SpellItem* Maint::SpellFactory::CreateInfiniteFrom(RE::SpellItem* const& base, std::optional<RE::FormID> aFormID)
+	SpellTemplateCache::Template SpellTemplateCache::Build(RE::SpellItem* base)
 	{
-		static auto* factory = RE::IFormFactory::GetConcreteFormFactoryByType<RE::SpellItem>();
+		Template t{};
+		t.formID = base->GetFormID();
+		t.maintainedName = std::format("Maintained {}", base->GetFullName());
+		t.baseCost = base->CalculateMagickaCost(nullptr);
+
+		t.keywords.reserve(base->numKeywords + 2);
+		for (std::uint32_t i = 0; i < base->numKeywords; ++i) {
+			if (auto kwd = base->GetKeywordAt(i); kwd && *kwd) {
+				t.keywords.push_back(*kwd);
+			}
+		}
 
-		auto* out = factory->Create();
-		if (!out) {
-			return nullptr;
+		for (auto* eff : base->effects) {
+			if (!eff || !eff->baseEffect) {
+				continue;
+			}
+			t.isCloak = t.isCloak || eff->baseEffect->HasArchetype(RE::EffectSetting::Archetype::kCloak);
+			t.isConjure = t.isConjure || eff->baseEffect->GetArchetype() == RE::EffectSetting::Archetype::kSummonCreature;
+		}
+
+		if (t.isCloak) {
+			t.keywords.push_back(FormsRepository::Get().KywdMagicCloak);
 		}
+		t.keywords.push_back(FormsRepository::Get().KywdMaintainedSpell);
+
+		return t;
+	}
+
+	// ================= SpellFactory ==============================================
 
+	RE::SpellItem* Maint::SpellFactory::CreateInfiniteFrom(RE::SpellItem* const& base, std::optional<RE::FormID> aFormID)
+	{
 		auto& forms = Allocator::Get();
 
 		std::optional<RE::FormID> allocatedFormID = aFormID ? forms.AllocateSpecificFormID(*aFormID) : forms.AllocateFormID();
@@ -505,9 +749,15 @@ namespace Maint
 			return nullptr;
 		}
 
-		out->SetFormID(*allocatedFormID, false);
+		auto* out = SpellFormPool::Acquire(*allocatedFormID);
+		if (!out) {
+			forms.FreeFormID(*allocatedFormID);
+			return nullptr;
+		}
+
+		const auto& tmpl = SpellTemplateCache::Get(base);
 
-		out->fullName = std::format("Maintained {}", base->GetFullName());
+		out->fullName = tmpl.maintainedName;
 		out->data = base->data;
 		out->avEffectSetting = base->avEffectSetting;
 		out->boundData = base->boundData;
@@ -518,33 +768,34 @@ namespace Maint
 		out->SetDelivery(RE::MagicSystem::Delivery::kSelf);
 		out->SetCastingType(RE::MagicSystem::CastingType::kConstantEffect);
 
-		for (uint32_t i = 0; i < base->numKeywords; ++i) {
-			out->AddKeyword(base->GetKeywordAt(i).value());
+		// One allocation for the whole keyword array
+		out->AddKeywords(tmpl.keywords);
+
+		if (!Config::CloneEffectSettings) {
+			out->effects = base->effects;
+			return out;
 		}
 
+		// Private effects, so FX silencing is a flag on this spell alone
+		std::size_t clonedBytes = 0;
+		out->effects.reserve(base->effects.size());
 		for (auto* eff : base->effects) {
-			if (eff->baseEffect && eff->baseEffect->HasArchetype(RE::EffectSetting::Archetype::kCloak)) {
-				out->AddKeyword(FormsRepository::Get().KywdMagicCloak);
-				break;
-			}
+			auto* clone = EffectClonePool::Clone(eff);
+			out->effects.push_back(clone ? clone : eff);
+			clonedBytes += clone ? EffectClonePool::BytesPerClone(clone) : 0;
 		}
-
-		out->AddKeyword(FormsRepository::Get().KywdMaintainedSpell);
-		out->effects = base->effects;
+		spdlog::debug("{}: {} bytes of cloned effects", out->GetName(), clonedBytes);
 		return out;
 	}
 
 	RE::SpellItem* Maint::SpellFactory::CreateDebuffFrom(RE::SpellItem* const& base, float const& magnitude, std::optional<RE::FormID> aFormID)
 	{
 		static auto* tmpl = FormsRepository::Get().SpelMagickaDebuffTemplate;
-		static auto* factory = RE::IFormFactory::GetConcreteFormFactoryByType<RE::SpellItem>();
 
 		const auto* file = base->GetFile(0);
 		const auto fileStr = file ? file->GetFilename() : "VIRTUAL";
 		spdlog::info("Debuffify({}, 0x{:08X}~{})", base->GetName(), file ? base->GetLocalFormID() : base->GetFormID(), fileStr);
 
-		auto* out = factory->Create();
-
 		auto& forms = Allocator::Get();
 
 		// Allocate FormID (specific or automatic)
@@ -557,9 +808,13 @@ namespace Maint
 			return nullptr;
 		}
 
-		out->SetFormID(*allocatedFormID, false);
+		auto* out = SpellFormPool::Acquire(*allocatedFormID);
+		if (!out) {
+			forms.FreeFormID(*allocatedFormID);
+			return nullptr;
+		}
 
-		out->fullName = std::format("Maintained {}", base->GetFullName());
+		out->fullName = SpellTemplateCache::Get(base).maintainedName;
 		out->data = RE::SpellItem::Data{ tmpl->data };
 		out->avEffectSetting = tmpl->avEffectSetting;
 		out->boundData = tmpl->boundData;
@@ -570,325 +825,617 @@ namespace Maint
 		out->SetCastingType(RE::MagicSystem::CastingType::kConstantEffect);
 		out->AddKeyword(FormsRepository::Get().KywdMaintainedSpell);
 
-		out->effects.emplace_back(tmpl->effects.front());
+		// Own copy of the template effect: re-pricing one debuff must not reach the others
+		out->effects.emplace_back(EffectClonePool::Copy(tmpl->effects.front()));
 		out->effects.back()->effectItem.magnitude = magnitude;
 
 		return out;
 	}
 
-	// ----------------------------
-	// Construction / singleton
-	// ----------------------------
+	// ================= SpellFormPool =============================================
 
-	Allocator& Allocator::Get()
+	RE::SpellItem* SpellFormPool::Acquire(RE::FormID formID)
 	{
-		static Allocator instance;
-		return instance;
-	}
+		static auto* factory = RE::IFormFactory::GetConcreteFormFactoryByType<RE::SpellItem>();
 
-	// ----------------------------
-	// Allocation interface
-	// ----------------------------
+		if (const auto it = forms_.find(formID); it != forms_.end()) {
+			++hits_;
+			spdlog::debug("SpellFormPool: reusing 0x{:08X} (hits {}, misses {})", formID, hits_, misses_);
+			Reset(it->second);
+			return it->second;
+		}
 
-	std::optional<RE::FormID> Allocator::AllocateFormID()
-	{
-		if (_allocatedMask == FULL_MASK) {
-			logger::error("FORMS::AllocateFormID() - No free FormIDs available");
-			return std::nullopt;
+		auto* out = factory->Create();
+		if (!out) {
+			return nullptr;
 		}
 
-		const std::uint32_t index = FindFirstFreeIndex(_allocatedMask);
-		SetIndexAllocated(index);
-		return MakeFullFormID(IndexToLocalID(index));
+		++misses_;
+		spdlog::debug("SpellFormPool: created 0x{:08X} (hits {}, misses {})", formID, hits_, misses_);
+		out->SetFormID(formID, false);
+		forms_.emplace(formID, out);
+		return out;
 	}
 
-	std::optional<RE::FormID> Allocator::AllocateSpecificFormID(RE::FormID fullFormID)
+	void SpellFormPool::Release(RE::SpellItem* spell)
 	{
-		if (!IsInManagedRange(fullFormID)) {
-			logger::error(
-				"Allocator::AllocateSpecificFormID() - FormID 0x{:08X} out of range",
-				fullFormID);
-			return std::nullopt;
+		if (!spell) {
+			return;
 		}
 
-		if (IsAllocated(fullFormID)) {
-			logger::warn(
-				"Allocator::AllocateSpecificFormID() - FormID 0x{:08X} already allocated",
-				fullFormID);
-			return std::nullopt;
+		for (auto* eff : spell->effects) {
+			EffectClonePool::Release(eff);
 		}
 
-		const std::uint32_t index =
-			LocalIDToIndex(ExtractLocalID(fullFormID));
-
-		SetIndexAllocated(index);
-
-		logger::debug(
-			"Allocator::AllocateSpecificFormID() - Allocated exact FormID 0x{:08X} (index={})",
-			fullFormID,
-			index);
-
-		return fullFormID;
+		const auto formID = spell->GetFormID();
+		if (const auto it = forms_.find(formID); it == forms_.end() || it->second != spell) {
+			// Not ours to keep; fall back to the engine's deferred delete
+			spell->SetDelete(true);
+		} else {
+			Reset(spell);
+		}
+		Allocator::Get().FreeFormID(formID);
 	}
 
-	void Allocator::FreeFormID(RE::FormID fullFormID)
+	void SpellFormPool::Reset(RE::SpellItem* spell)
 	{
-		if (!IsAllocated(fullFormID)) {
-			return;
+		spell->fullName = "";
+		spell->effects.clear();
+		spell->avEffectSetting = nullptr;
+		spell->equipSlot = nullptr;
+
+		if (spell->numKeywords > 0) {
+			const std::vector<RE::BGSKeyword*> keywords(spell->keywords, spell->keywords + spell->numKeywords);
+			spell->RemoveKeywords(keywords);
 		}
-
-		const std::uint32_t index =
-			LocalIDToIndex(ExtractLocalID(fullFormID));
-
-		ClearIndexAllocated(index);
 	}
 
-	void Allocator::ReconcileWithCache()
+	void SpellFormPool::LogStats()
 	{
-		std::uint64_t referencedMask = 0;
+		spdlog::info("SpellFormPool: {} forms, {} hits, {} misses", forms_.size(), hits_, misses_);
+	}
 
-		const auto& map = MaintainedRegistry::Get().map();
+	// ================= EffectClonePool ===========================================
 
-		for (const auto& [_, pair] : map) {
-			if (pair.infinite) {
-				MarkReferenced(referencedMask, pair.infinite->GetFormID());
-			}
-			if (pair.debuff) {
-				MarkReferenced(referencedMask, pair.debuff->GetFormID());
-			}
+	RE::Effect* EffectClonePool::Clone(const RE::Effect* src)
+	{
+		if (!src || !src->baseEffect) {
+			return nullptr;
 		}
 
-		const std::uint64_t staleMask = _allocatedMask & ~referencedMask;
-
-		if (staleMask == 0) {
-			return;
+		auto& forms = Allocator::Clones();
+		const auto formID = forms.AllocateFormID();
+		if (!formID) {
+			logger::warn("EffectClonePool::Clone() - Out of FormIDs; sharing {}", src->baseEffect->GetName());
+			return nullptr;
 		}
 
-		for (std::uint32_t index = 0; index < TOTAL_IDS; ++index) {
-			const std::uint64_t bit = BitForIndex(index);
-			if ((staleMask & bit) == 0) {
-				continue;
-			}
-
-			const RE::FormID fullFormID =
-				MakeFullFormID(IndexToLocalID(index));
+		auto* setting = AcquireSetting(*formID);
+		if (!setting) {
+			forms.FreeFormID(*formID);
+			return nullptr;
+		}
 
-			logger::info(
-				"FORMS::ReconcileWithCache() - Freeing stale FormID 0x{:08X}",
-				fullFormID);
+		const auto* from = src->baseEffect;
+		setting->fullName = from->fullName;
+		setting->data = from->data;
+		setting->magicItemDescription = from->magicItemDescription;
+		setting->conditions.head = from->conditions.head;  // borrowed; Reset() lets go before reuse
 
-			FreeFormID(fullFormID);
+		if (from->numKeywords > 0) {
+			const std::vector<RE::BGSKeyword*> keywords(from->keywords, from->keywords + from->numKeywords);
+			setting->AddKeywords(keywords);
 		}
-	}
 
-	bool Allocator::IsAllocated(RE::FormID fullFormID) const
-	{
-		if (!IsInManagedRange(fullFormID)) {
-			return false;
-		}
+		auto* clone = AcquireEffect();
+		clone->effectItem = src->effectItem;
+		clone->baseEffect = setting;
+		clone->cost = src->cost;
+		clone->conditions.head = src->conditions.head;
 
-		return IsIndexAllocated(
-			LocalIDToIndex(ExtractLocalID(fullFormID)));
+		sources_.emplace(clone, src);
+		return clone;
 	}
 
-	std::size_t Allocator::GetFreeFormIDCount() const
+	RE::Effect* EffectClonePool::Copy(const RE::Effect* src)
 	{
-		return TOTAL_IDS - std::popcount(_allocatedMask);
+		auto* copy = AcquireEffect();
+		copy->effectItem = src->effectItem;
+		copy->baseEffect = src->baseEffect;
+		copy->cost = src->cost;
+		copy->conditions.head = src->conditions.head;
+
+		copies_.insert(copy);
+		return copy;
 	}
 
-	void Allocator::Clear()
+	void EffectClonePool::Release(RE::Effect* effect)
 	{
-		if (_allocatedMask != 0) {
-			logger::info(
-				"Allocator::Clear() - Releasing {} FormIDs",
-				std::popcount(_allocatedMask));
+		// A recycled effect must not inherit a pending FX restore aimed at its previous life
+		if (copies_.contains(effect) || sources_.contains(effect)) {
+			EffectRestorer::Forget(effect);
 		}
 
-		_allocatedMask = 0;
-	}
+		if (copies_.erase(effect) != 0) {
+			effect->baseEffect = nullptr;
+			effect->conditions.head = nullptr;
+			freeEffects_.push_back(effect);
+			return;
+		}
 
-	// ----------------------------
-	// Bitmask helpers
-	// ----------------------------
+		const auto it = sources_.find(effect);
+		if (it == sources_.end()) {
+			return;
+		}
+		sources_.erase(it);
 
-	std::uint32_t Allocator::FindFirstFreeIndex(std::uint64_t mask)
-	{
-		return static_cast<std::uint32_t>(
-			std::countr_zero(~mask));
+		if (auto* setting = effect->baseEffect) {
+			Reset(setting);
+			Allocator::Clones().FreeFormID(setting->GetFormID());
+		}
+
+		effect->baseEffect = nullptr;
+		effect->conditions.head = nullptr;
+		freeEffects_.push_back(effect);
 	}
 
-	constexpr std::uint64_t Allocator::BitForIndex(std::uint32_t index)
+	const RE::Effect* EffectClonePool::SourceOf(const RE::Effect* effect)
 	{
-		return (index < 64) ? (1ull << index) : 0ull;
+		const auto it = sources_.find(effect);
+		return it != sources_.end() ? it->second : nullptr;
 	}
 
-	void Allocator::SetIndexAllocated(std::uint32_t index)
+	std::size_t EffectClonePool::BytesPerClone(const RE::Effect* effect)
 	{
-		_allocatedMask |= BitForIndex(index);
+		const auto keywords = effect && effect->baseEffect ? effect->baseEffect->numKeywords : 0;
+		return sizeof(RE::Effect) + sizeof(RE::EffectSetting) + keywords * sizeof(RE::BGSKeyword*);
 	}
 
-	void Allocator::ClearIndexAllocated(std::uint32_t index)
+	void EffectClonePool::LogStats()
 	{
-		_allocatedMask &= ~BitForIndex(index);
+		std::size_t bytes = blocks_.size() * kBlockEffects * sizeof(RE::Effect) + settings_.size() * sizeof(RE::EffectSetting);
+		spdlog::info(
+			"EffectClonePool: {} live clones, {} debuff copies, {} pooled settings, {} free effects, ~{} KiB",
+			sources_.size(),
+			copies_.size(),
+			settings_.size(),
+			freeEffects_.size(),
+			bytes / 1024);
 	}
 
-	bool Allocator::IsIndexAllocated(std::uint32_t index) const
+	RE::EffectSetting* EffectClonePool::AcquireSetting(RE::FormID formID)
 	{
-		return (_allocatedMask & BitForIndex(index)) != 0;
+		static auto* factory = RE::IFormFactory::GetConcreteFormFactoryByType<RE::EffectSetting>();
+
+		if (const auto it = settings_.find(formID); it != settings_.end()) {
+			return it->second;
+		}
+
+		auto* out = factory->Create();
+		if (!out) {
+			return nullptr;
+		}
+
+		out->SetFormID(formID, false);
+		settings_.emplace(formID, out);
+		return out;
 	}
 
-	void Allocator::MarkReferenced(std::uint64_t& mask, RE::FormID fullFormID) const
+	RE::Effect* EffectClonePool::AcquireEffect()
 	{
-		if (!IsInManagedRange(fullFormID)) {
-			return;
+		if (!freeEffects_.empty()) {
+			auto* effect = freeEffects_.back();
+			freeEffects_.pop_back();
+			return effect;
+		}
+
+		// Raw blocks: clones borrow their condition lists, so they must never be destroyed
+		if (blockUsed_ == kBlockEffects) {
+			blocks_.push_back(std::make_unique<std::byte[]>(kBlockEffects * sizeof(RE::Effect)));
+			blockUsed_ = 0;
 		}
 
-		const std::uint32_t index =
-			LocalIDToIndex(ExtractLocalID(fullFormID));
+		auto* slot = blocks_.back().get() + blockUsed_++ * sizeof(RE::Effect);
+		return ::new (slot) RE::Effect();
+	}
 
-		mask |= BitForIndex(index);
+	void EffectClonePool::Reset(RE::EffectSetting* setting)
+	{
+		setting->fullName = "";
+		setting->data = RE::EffectSetting::EffectSettingData{};
+		setting->magicItemDescription = "";
+		setting->conditions.head = nullptr;
+
+		if (setting->numKeywords > 0) {
+			const std::vector<RE::BGSKeyword*> keywords(setting->keywords, setting->keywords + setting->numKeywords);
+			setting->RemoveKeywords(keywords);
+		}
 	}
 
 	// ----------------------------
-	// ID mapping
+	// Construction / singleton
 	// ----------------------------
 
-	constexpr RE::FormID Allocator::IndexToLocalID(std::uint32_t index)
+	Allocator& Allocator::Get()
 	{
-		return index + MIN_LOCAL_ID;
+		static Allocator instance{ FORMID_OFFSET_BASE, DEFAULT_TOTAL_IDS };
+		return instance;
 	}
 
-	constexpr std::uint32_t Allocator::LocalIDToIndex(RE::FormID localID)
+	Allocator& Allocator::Clones()
 	{
-		return localID - MIN_LOCAL_ID;
+		static Allocator instance{ CLONE_FORMID_OFFSET_BASE, MAX_TOTAL_IDS };
+		return instance;
 	}
 
-	constexpr RE::FormID Allocator::MakeFullFormID(RE::FormID localID)
+	Allocator::Allocator(RE::FormID base, std::uint32_t totalIDs) :
+		_ids(base, MIN_LOCAL_ID, totalIDs)
+	{}
+
+	bool Allocator::Configure(std::uint32_t totalIDs)
 	{
-		return FORMID_OFFSET_BASE + localID;
+		totalIDs = std::clamp<std::uint32_t>(totalIDs, 2, MAX_TOTAL_IDS);
+		if (totalIDs == _ids.capacity()) {
+			return true;
+		}
+
+		if (!_ids.Resize(totalIDs)) {
+			logger::warn(
+				"Allocator::Configure() - {} FormIDs in use; keeping range of {}",
+				_ids.count(),
+				_ids.capacity());
+			return false;
+		}
+
+		logger::info(
+			"Allocator::Configure() - Managing {} FormIDs (0x{:08X}-0x{:08X})",
+			totalIDs,
+			_ids.IdAt(0),
+			_ids.IdAt(totalIDs - 1));
+		return true;
 	}
 
-	constexpr RE::FormID Allocator::ExtractLocalID(RE::FormID fullFormID)
+	// ----------------------------
+	// Allocation interface
+	// ----------------------------
+
+	std::optional<RE::FormID> Allocator::AllocateFormID()
 	{
-		return fullFormID - FORMID_OFFSET_BASE;
+		const auto formID = _ids.Allocate();
+		if (!formID) {
+			logger::error("FORMS::AllocateFormID() - No free FormIDs available");
+		}
+		return formID;
 	}
 
-	constexpr bool Allocator::IsInManagedRange(RE::FormID fullFormID)
+	std::optional<RE::FormID> Allocator::AllocateSpecificFormID(RE::FormID fullFormID)
 	{
-		const RE::FormID localID = ExtractLocalID(fullFormID);
-		return localID >= MIN_LOCAL_ID && localID <= MAX_LOCAL_ID;
+		if (!_ids.InRange(fullFormID)) {
+			logger::error(
+				"Allocator::AllocateSpecificFormID() - FormID 0x{:08X} out of range",
+				fullFormID);
+			return std::nullopt;
+		}
+
+		if (!_ids.AllocateSpecific(fullFormID)) {
+			logger::warn(
+				"Allocator::AllocateSpecificFormID() - FormID 0x{:08X} already allocated",
+				fullFormID);
+			return std::nullopt;
+		}
+
+		logger::debug(
+			"Allocator::AllocateSpecificFormID() - Allocated exact FormID 0x{:08X}",
+			fullFormID);
+
+		return fullFormID;
 	}
 
-	// ================= MaintainedEffectsCache ====================================
+	void Allocator::FreeFormID(RE::FormID fullFormID)
+	{
+		_ids.Free(fullFormID);
+	}
 
-	void MaintainedEffectsCache::rebuild(RE::Actor* actor)
+	void Allocator::ReconcileWithCache()
 	{
-		cache_.clear();
+		const auto markAll = [](const auto& mark) {
+			const auto markReferenced = [&](const RE::TESForm* form) {
+				if (form) {
+					mark(form->GetFormID());
+				}
+			};
 
-		static const auto& mmDebufEffect = FormsRepository::Get().SpelMagickaDebuffTemplate->effects.front();
-		const auto& effList = actor->AsMagicTarget()->GetActiveEffectList();
-
-		for (auto* e : *effList) {
-			if (auto* asSpl = e->spell ? e->spell->As<RE::SpellItem>() : nullptr;
-				asSpl && e->effect->baseEffect != mmDebufEffect->baseEffect) {
-				const bool hasKywd = asSpl->HasKeyword(FormsRepository::Get().KywdMaintainedSpell);
-				const bool isBaseSpell = MaintainedRegistry::Get().hasBase(asSpl);
-
-				if (isBaseSpell) {
-					if (auto* pair = MaintainedRegistry::Get().getByBase(asSpl)) {
-						auto* mSpl = pair->infinite;
-						cache_[mSpl].push_back(e);
+			const auto markRegistry = [&](MaintainedRegistry& registry) {
+				for (const auto& [_, pair] : registry.entries()) {
+					markReferenced(pair.infinite);
+					markReferenced(pair.debuff);
+
+					// Cloned magic effects hold FormIDs of their own
+					for (const auto* eff : pair.infinite->effects) {
+						if (EffectClonePool::SourceOf(eff)) {
+							markReferenced(eff->baseEffect);
+						}
 					}
-				} else if (hasKywd) {
-					e->elapsedSeconds = 0.0f;
-					cache_[asSpl].push_back(e);
 				}
-			}
+
+				// Deferred bound weapons hold on to their form until the hand is restored
+				registry.forEachDeferred([&](RE::SpellItem* maintained, RE::SpellItem*, bool&) {
+					markReferenced(maintained);
+				});
+			};
+
+			markRegistry(MaintainedRegistry::Get());
+			MaintainedRegistry::ForEachNPC([&](RE::ActorHandle, MaintainedRegistry& registry) {
+				markRegistry(registry);
+			});
+		};
+
+		_ids.Reconcile(markAll, [](RE::FormID stale) {
+			logger::info("FORMS::ReconcileWithCache() - Freeing stale FormID 0x{:08X}", stale);
+		});
+	}
+
+	bool Allocator::IsAllocated(RE::FormID fullFormID) const
+	{
+		return _ids.IsAllocated(fullFormID);
+	}
+
+	std::size_t Allocator::GetFreeFormIDCount() const
+	{
+		return _ids.free();
+	}
+
+	void Allocator::Clear()
+	{
+		if (_ids.count() != 0) {
+			logger::info(
+				"Allocator::Clear() - Releasing {} FormIDs",
+				_ids.count());
 		}
+
+		_ids.Clear();
 	}
-	const std::unordered_map<RE::SpellItem*, std::vector<RE::ActiveEffect*>>&
-		MaintainedEffectsCache::GetFor(RE::Actor* actor)
+
+	// ================= MaintainedEffectsCache ====================================
+
+	EngineEffects::Classification EngineEffects::Classify(MaintainedRegistry* registry, RE::ActiveEffect* e)
 	{
-		const auto count = std::ranges::distance(actor->AsMagicTarget()->GetActiveEffectList()->begin(),
-			actor->AsMagicTarget()->GetActiveEffectList()->end());
-		if (static_cast<std::size_t>(count) != cache_.size()) {
-			rebuild(actor);
+		static const auto& mmDebufEffect = FormsRepository::Get().SpelMagickaDebuffTemplate->effects.front();
+
+		auto* asSpl = e->spell ? e->spell->As<RE::SpellItem>() : nullptr;
+		if (!asSpl || e->effect->baseEffect == mmDebufEffect->baseEffect) {
+			return {};
 		}
-		return cache_;
+
+		if (auto* pair = registry ? registry->get(registry->find(asSpl)) : nullptr) {
+			return { pair->infinite, false };
+		}
+		if (asSpl->HasKeyword(FormsRepository::Get().KywdMaintainedSpell)) {
+			return { asSpl, true };
+		}
+		return {};
 	}
-	void MaintainedEffectsCache::Clear() {
-		cache_.clear();
+
+	// ================= ValidationScheduler =======================================
+
+	float ValidationScheduler::CadenceFor(const RE::SpellItem* base)
+	{
+		if (!base || base->effects.empty() || !base->effects[0]->baseEffect) {
+			return kCadenceDefault;
+		}
+
+		if (IsBoundWeaponSpell(base) || IsSummonSpell(base)) {
+			return kCadenceFast;
+		}
+
+		// Cloaks and long self buffs rarely drop on their own; effect removals still re-check them at once
+		for (auto* eff : base->effects) {
+			if (eff && eff->baseEffect && eff->baseEffect->HasArchetype(RE::EffectSetting::Archetype::kCloak)) {
+				return kCadenceSlow;
+			}
+		}
+		if (IsSelfDelivery(base) && base->effects[0]->GetDuration() >= 120) {
+			return kCadenceSlow;
+		}
+
+		return kCadenceDefault;
 	}
 
 	// ================= Policy / Calculations =====================================
 
-	bool SpellEligibilityPolicy::IsMaintainable(RE::SpellItem* const& s, RE::Actor* const& caster)
+	namespace
 	{
-		if (!s || !caster)
-			return false;
+		using Rule = SpellEligibilityPolicy::Rule;
 
-		const std::size_t freeIDs = Allocator::Get().GetFreeFormIDCount();
+		struct StaticRule
+		{
+			Rule rule;
+			std::string_view reason;
+			bool (*rejects)(RE::SpellItem*);
+		};
 
-		if (freeIDs < 2) {
-			logger::info(
-				"Not enough free FormIDs to maintain spell ({} free)",
-				freeIDs);
-			return false;
+		// Cheapest first: flag and pointer tests, then keyword scans, then the editor ID string
+		// lookup. kNoEffects guards every rule that reads effects[0].
+		constexpr std::array kStaticRules{
+			StaticRule{ Rule::kNoEffects, "Spell has no effects",
+				[](RE::SpellItem* s) { return s->effects.empty(); } },
+			StaticRule{ Rule::kNotFireAndForget, "Not FF",
+				[](RE::SpellItem* s) { return s->data.castingType != RE::MagicSystem::CastingType::kFireAndForget; } },
+			StaticRule{ Rule::kScroll, "Spell is Scroll",
+				[](RE::SpellItem* s) { return s->As<RE::ScrollItem>() != nullptr; } },
+			StaticRule{ Rule::kEnchantment, "Spell is Enchantment",
+				[](RE::SpellItem* s) { return s->As<RE::EnchantmentItem>() != nullptr; } },
+			StaticRule{ Rule::kShortDuration, "Duration <= 5s",
+				[](RE::SpellItem* s) { return s->effects.front()->GetDuration() <= 5.0; } },
+			StaticRule{ Rule::kNotSelfOrSummon, "Not self and not summon",
+				[](RE::SpellItem* s) {
+					return !IsSelfDelivery(s) &&
+				           s->effects[0]->baseEffect->GetArchetype() != RE::EffectSetting::Archetype::kSummonCreature;
+				} },
+			StaticRule{ Rule::kMaintainedKeyword, "Has Maintained kwd",
+				[](RE::SpellItem* s) { return s->HasKeyword(FormsRepository::Get().KywdMaintainedSpell); } },
+			StaticRule{ Rule::kExcludedKeyword, "Has exclusion kwd",
+				[](RE::SpellItem* s) { return s->HasKeyword(FormsRepository::Get().KywdExcludeFromSystem); } },
+			StaticRule{ Rule::kAllyLinkKeyword, "Has Allylink kwd",
+				[](RE::SpellItem* s) { return s->HasKeywordString("_m3HealerDummySpell"); } },
+		};
+
+		// The table doubles as the enum's description lookup
+		static_assert(std::ranges::is_sorted(kStaticRules, {}, &StaticRule::rule));
+		static_assert(kStaticRules.size() == static_cast<std::size_t>(Rule::kNoFormIDs));
+
+		constexpr std::array<std::string_view, static_cast<std::size_t>(Rule::kTotal) - kStaticRules.size()> kDynamicReasons{
+			"Not enough free FormIDs",
+			"Cost <= 5",
+			"Bound weapon disallowed",
+			"Already dual-equipped bound",
+		};
+	}
+
+	SpellEligibilityPolicy::Rule SpellEligibilityPolicy::StaticRejection(RE::SpellItem* s)
+	{
+		for (const auto& rule : kStaticRules) {
+			if (rule.rejects(s)) {
+				return rule.rule;
+			}
 		}
-		if (s->As<RE::ScrollItem>()) {
-			spdlog::info("Spell is Scroll");
-			return false;
+		return Rule::kNone;
+	}
+
+	std::string_view SpellEligibilityPolicy::Describe(Rule rule) noexcept
+	{
+		const auto index = static_cast<std::size_t>(rule);
+		if (index < kStaticRules.size()) {
+			return kStaticRules[index].reason;
 		}
-		if (s->As<RE::EnchantmentItem>()) {
-			spdlog::info("Spell is Enchantment");
-			return false;
+		if (index < static_cast<std::size_t>(Rule::kTotal)) {
+			return kDynamicReasons[index - kStaticRules.size()];
 		}
-		if (s->effects.empty()) {
-			spdlog::info("Spell has no effects");
-			return false;
+		return "Eligible";
+	}
+
+	// Counts every rejection; only logs when the verdict was just computed, not replayed from a memo
+	SpellEligibilityPolicy::Rule SpellEligibilityPolicy::Reject(Rule rule, bool fresh)
+	{
+		++rejections_[static_cast<std::size_t>(rule)];
+		if (fresh) {
+			spdlog::info("{}", Describe(rule));
 		}
-		if (s->data.castingType != RE::MagicSystem::CastingType::kFireAndForget) {
-			spdlog::info("Not FF");
-			return false;
+		return rule;
+	}
+
+	void SpellEligibilityPolicy::LogRejections()
+	{
+		std::string summary;
+		for (std::size_t i = 0; i < rejections_.size(); ++i) {
+			if (rejections_[i] != 0) {
+				summary += std::format("{}{}={}", summary.empty() ? "" : ", ", Describe(static_cast<Rule>(i)), rejections_[i]);
+			}
 		}
+		if (preclassifiedRejections_ != 0) {
+			summary += std::format("{}Preclassified ineligible={}", summary.empty() ? "" : ", ", preclassifiedRejections_);
+		}
+		if (!summary.empty()) {
+			spdlog::info("Eligibility rejections: {}", summary);
+		}
+	}
 
-		if (const auto dur = s->effects.front()->GetDuration(); dur <= 5.0) {
-			spdlog::info("Duration <= 5s");
-			return false;
+	void SpellEligibilityPolicy::Preclassify()
+	{
+		auto* data = RE::TESDataHandler::GetSingleton();
+		if (!data) {
+			return;
 		}
-		{
-			const auto cWith = s->CalculateMagickaCost(caster);
-			const auto cWithout = s->CalculateMagickaCost(nullptr);
-			if (cWith <= 5.0 && cWithout <= 5.0) {
-				spdlog::info("Cost <= 5");
-				return false;
+
+		const auto start = std::chrono::steady_clock::now();
+
+		std::vector<RE::SpellItem*> spells;
+		spells.reserve(data->GetFormArray<RE::SpellItem>().size());
+		for (auto* spell : data->GetFormArray<RE::SpellItem>()) {
+			if (spell) {
+				spells.push_back(spell);
 			}
 		}
 
-		if (s->HasKeyword(FormsRepository::Get().KywdMaintainedSpell)) {
-			spdlog::info("Has Maintained kwd");
+		// Dense index == position in FormID order, matching DenseIdFlags
+		std::ranges::sort(spells, {}, &RE::SpellItem::GetFormID);
+		const auto dupes = std::ranges::unique(spells, {}, &RE::SpellItem::GetFormID);
+		spells.erase(dupes.begin(), dupes.end());
+
+		std::vector<std::uint32_t> ids(spells.size());
+		std::ranges::transform(spells, ids.begin(), &RE::SpellItem::GetFormID);
+		preclassified_.Assign(std::move(ids));
+
+		// Resolve the shared keywords before any worker can race the singleton's construction
+		(void)FormsRepository::Get();
+
+		// The rules only read form data, so words are classified in parallel
+		preclassified_.Classify(std::execution::par, [&](std::size_t i) {
+			return StaticRejection(spells[i]) == Rule::kNone;
+		});
+
+		const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+		spdlog::info(
+			"Preclassified {} spells in {:.2f} ms ({} eligible, {} hardware threads)",
+			preclassified_.size(),
+			elapsed.count(),
+			preclassified_.count(),
+			std::thread::hardware_concurrency());
+	}
+
+	bool SpellEligibilityPolicy::IsMaintainable(RE::SpellItem* const& s, RE::Actor* const& caster)
+	{
+		if (!s || !caster)
 			return false;
-		}
-		if (s->HasKeyword(FormsRepository::Get().KywdExcludeFromSystem)) {
-			spdlog::info("Has exclusion kwd");
+
+		// Static rules first, so rejected spells never enter SpellTemplateCache; load-order
+		// spells already carry a verdict from Preclassify, runtime ones are checked each cast
+		const auto preclassified = PreclassifiedEligible(s->GetFormID());
+		if (preclassified.has_value() && !*preclassified) {
+			++preclassifiedRejections_;
 			return false;
 		}
-		if (s->HasKeywordString("_m3HealerDummySpell")) {
-			spdlog::info("Has Allylink kwd");
+		if (!preclassified.has_value()) {
+			if (const auto rule = StaticRejection(s); rule != Rule::kNone) {
+				Reject(rule, true);
+				return false;
+			}
+		}
+
+		const std::size_t freeIDs = Allocator::Get().GetFreeFormIDCount();
+		if (freeIDs < 2) {
+			logger::info(
+				"Not enough free FormIDs to maintain spell ({} free)",
+				freeIDs);
+			Reject(Rule::kNoFormIDs, false);
 			return false;
 		}
 
-		const auto arche = s->effects[0]->baseEffect->GetArchetype();
-		if (!IsSelfDelivery(s)) {
-			if (arche == RE::EffectSetting::Archetype::kSummonCreature)
-				return true;
-			spdlog::info("Not self and not summon");
+		// Cost verdicts are memoized on the template of spells that were maintained before;
+		// a spell seen for the first time is priced directly and only cached once it passes
+		if (const auto* tmpl = SpellTemplateCache::Find(s)) {
+			// The caster's cost is only needed for spells that are already cheap without one
+			if (tmpl->baseCost <= 5.0) {
+				const bool costFresh = tmpl->costCaster != caster->GetFormID() || tmpl->costEpoch != casterEpoch_;
+				if (costFresh) {
+					tmpl->costCaster = caster->GetFormID();
+					tmpl->costEpoch = casterEpoch_;
+					tmpl->tooCheap = s->CalculateMagickaCost(caster) <= 5.0;
+				}
+				if (tmpl->tooCheap) {
+					Reject(Rule::kTooCheap, costFresh);
+					return false;
+				}
+			}
+		} else if (s->CalculateMagickaCost(nullptr) <= 5.0 && s->CalculateMagickaCost(caster) <= 5.0) {
+			Reject(Rule::kTooCheap, true);
 			return false;
 		}
 
+		const auto arche = s->effects[0]->baseEffect->GetArchetype();
 		if (arche == RE::EffectSetting::Archetype::kBoundWeapon) {
 			if (!Config::AllowBoundWeapons) {
-				spdlog::info("Bound weapon disallowed");
+				Reject(Rule::kBoundDisallowed, true);
 				return false;
 			}
 
@@ -903,7 +1450,7 @@ namespace Maint
 			const bool rightSame = rightSpell && !rightSpell->effects.empty() && rightSpell->effects[0]->baseEffect->data.associatedForm == assoc;
 
 			if (leftSame && rightSame) {
-				spdlog::info("Already dual-equipped bound");
+				Reject(Rule::kBoundDualEquipped, true);
 				RE::DebugNotification(std::format("Only one instance of {} can be maintained.", s->GetName()).c_str());
 				return false;
 			}
@@ -912,91 +1459,82 @@ namespace Maint
 		return true;
 	}
 
-	float UpkeepCostCalculator::Calculate(RE::SpellItem* const& spell, RE::Actor* const& caster)
+	UpkeepCostCalculator::Inputs UpkeepCostCalculator::Measure(RE::SpellItem* spell, RE::Actor* caster)
 	{
-		spdlog::info("CalculateUpkeepCost()");
-
 		// 1. Base magicka cost (after perks, dual-cast, etc.)
-		const float baseCost = spell->CalculateMagickaCost(caster);
-		if (baseCost <= 0.0f) {
-			spdlog::info("Base cost is zero; upkeep = 0");
-			return 0.0f;
-		}
-
-		// Neutral duration reference (seconds)
-		const float neutral = static_cast<float>(Config::CostBaseDuration);
-		if (neutral <= 0.0f) {
-			spdlog::info("Neutral duration disabled; upkeep = base cost");
-			return std::round(baseCost);
-		}
-
-		// 2. Ask Skyrim how long the spell ACTUALLY lasted
-		float realDuration = 0.0f;
+		Inputs in{ .baseCost = spell->CalculateMagickaCost(caster) };
 
+		// 2. Ask Skyrim how long the spell ACTUALLY lasted; only known while the cast is active
 		if (auto* magicTarget = caster->AsMagicTarget()) {
 			if (auto* effects = magicTarget->GetActiveEffectList()) {
 				for (auto* aeff : *effects) {
-					if (!aeff) {
-						continue;
-					}
-
-					if (aeff->spell == spell &&
-						aeff->GetCasterActor().get() == caster) {
-						realDuration = std::max(aeff->duration, 1.0f);
+					if (aeff && aeff->spell == spell && aeff->GetCasterActor().get() == caster) {
+						in.realDuration = (std::max)(aeff->duration, 1.0f);
 						break;
 					}
 				}
 			}
 		}
 
-		// Safety fallback (should be rare)
-		if (realDuration <= 0.0f) {
-			spdlog::warn("Failed to find active effect duration; using neutral");
-			realDuration = neutral;
+		if (in.realDuration <= 0.0f) {
+			spdlog::warn("Failed to find active effect duration for {}; pricing as neutral", spell->GetName());
 		}
+		return in;
+	}
 
-		// 3. Duration scaling — SINGLE tuning knob
-		//   ratio > 1  => short spell => punishing
-		//   ratio < 1  => long spell  => cheaper
-		const float ratio = neutral / realDuration;
-		const float exponent = Config::UpkeepDurationExponent;
-		const float durationMult = std::pow(ratio, exponent);
+	float UpkeepCostCalculator::RegenMultiplier(RE::Actor* caster)
+	{
+		// Soft magicka regen penalty
+		const float regen = caster->AsActorValueOwner()->GetActorValue(RE::ActorValue::kMagickaRateMult);
+		return regen > 0.0f ? 500.0f / (500.0f + regen) : 1.0f;
+	}
 
-		// 4. Soft magicka regen penalty (unchanged intent)
-		float regenMult = 1.0f;
-		const float regen =
-			caster->AsActorValueOwner()->GetActorValue(
-				RE::ActorValue::kMagickaRateMult);
+	void UpkeepCostCalculator::PriceBatch(
+		std::span<const float> baseCosts,
+		std::span<const float> durations,
+		float regenMultiplier,
+		std::span<float> out)
+	{
+		// Neutral duration reference (seconds); the duration scaling is the single tuning knob
+		Core::UpkeepPricing::PriceBatch(
+			baseCosts,
+			durations,
+			static_cast<float>(Config::CostBaseDuration),
+			Config::UpkeepDurationExponent,
+			regenMultiplier,
+			out);
+	}
 
-		if (regen > 0.0f) {
-			regenMult = 500.0f / (500.0f + regen);
-		}
+	float UpkeepCostCalculator::Calculate(RE::SpellItem* const& spell, RE::Actor* const& caster)
+	{
+		MAINT_PROBE(kUpkeepCost);
 
-		// 5. Final upkeep
-		const float finalMult = durationMult * regenMult;
-		const float finalCost =
-			std::max(1.0f, std::round(baseCost * finalMult));
+		const auto in = Measure(spell, caster);
+		const float regenMult = RegenMultiplier(caster);
 
-		spdlog::info(
-			"UpkeepCost: Base={:.2f} RealDur={:.1f}s Neutral={:.1f} "
-			"Ratio={:.3f} Exp={:.3f} Mult={:.3f} Final={:.0f}",
-			baseCost,
-			realDuration,
-			neutral,
-			ratio,
-			exponent,
-			finalMult,
-			finalCost);
+		float cost = 0.0f;
+		PriceBatch({ &in.baseCost, 1 }, { &in.realDuration, 1 }, regenMult, { &cost, 1 });
 
-		return finalCost;
+		spdlog::debug(
+			"UpkeepCost({}): Base={:.2f} RealDur={:.1f}s Exp={:.3f} Regen={:.3f} Final={:.0f}",
+			spell->GetName(),
+			in.baseCost,
+			in.realDuration,
+			Config::UpkeepDurationExponent,
+			regenMult,
+			cost);
+
+		return cost;
 	}
 
 	// ================= EffectRestorer ============================================
 
-	std::vector<EffectRestorer::RestoreEntry>& EffectRestorer::Pending()
+	double EffectRestorer::Now()
 	{
-		static std::vector<RestoreEntry> pending;
-		return pending;
+		if (Config::FXRestoreRealTime) {
+			return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+		return gameClock_;
 	}
 
 	void EffectRestorer::Push(RE::Effect* effect, float delaySeconds)
@@ -1004,15 +1542,25 @@ namespace Maint
 		if (!effect || !effect->baseEffect)
 			return;
 
-		for (auto& entry : Pending()) {
-			if (entry.effect == effect) {
-				// Extend silence window if needed
-				entry.remaining = (std::max)(entry.remaining, delaySeconds);
-				return;
-			}
-		}
+		// Re-pushing an effect only extends its silence window
+		const float delay = delaySeconds > 0.0f ? delaySeconds : Maint::Config::kDefaultFXRestoreDelay;
+		pending_.Arm(effect, Now() + delay);
+	}
 
-		Pending().push_back({ effect, delaySeconds > 0.0f ? delaySeconds : Maint::Config::kDefaultFXRestoreDelay });
+	void EffectRestorer::PushBatch(std::span<RE::Effect* const> effects, float delaySeconds)
+	{
+		if (effects.empty())
+			return;
+
+		const float delay = delaySeconds > 0.0f ? delaySeconds : Maint::Config::kDefaultFXRestoreDelay;
+		const double deadline = Now() + delay;
+
+		for (auto* effect : effects) {
+			if (!effect || !effect->baseEffect)
+				continue;
+
+			pending_.Arm(effect, deadline);
+		}
 	}
 
 	void EffectRestorer::Update(float deltaSeconds)
@@ -1020,39 +1568,36 @@ namespace Maint
 		if (deltaSeconds <= 0.0f)
 			return;
 
-		auto& pending = Pending();
-		if (pending.empty())
-			return;
+		pending_.AdvanceFrame();
+		gameClock_ += deltaSeconds;
 
-		// Clamp delta to avoid large spikes instantly restoring FX
-		constexpr float kMaxDeltaStep = 0.1f;  // 100 ms per update
-		const float step = (std::min)(deltaSeconds, kMaxDeltaStep);
+		if (pending_.empty())
+			return;
 
-		for (auto it = pending.begin(); it != pending.end();) {
-			auto* effect = it->effect;
+		// A hitch can pass the whole delay in one update; the frame guard holds the FX off anyway
+		due_.clear();
+		pending_.PopDue(Now(), Config::kFXRestoreMinFrames, due_);
 
+		for (auto* effect : due_) {
 			// Effect died or became invalid — just drop it
 			if (!effect || !effect->baseEffect) {
-				it = pending.erase(it);
 				continue;
 			}
 
-			it->remaining -= step;
-
-			if (it->remaining <= 0.0f) {
-				// Restore only FXPersist
-				effect->baseEffect->data.flags.set(RE::EffectSetting::EffectSettingData::Flag::kFXPersist);
-
-				it = pending.erase(it);
-			} else {
-				++it;
-			}
+			// Restore only FXPersist
+			effect->baseEffect->data.flags.set(RE::EffectSetting::EffectSettingData::Flag::kFXPersist);
 		}
 	}
 
+	void EffectRestorer::Forget(RE::Effect* effect)
+	{
+		pending_.Forget(effect);
+	}
+
 	void EffectRestorer::Clear()
 	{
-		Pending().clear();
+		pending_.Clear();
+		due_.clear();
 	}
 
 	// ================= ExperienceService =========================================
@@ -1061,7 +1606,7 @@ namespace Maint
 	{
 		if (Config::MaintainedExpMultiplier <= 0.0f)
 			return;
-		for (const auto& [base, _] : MaintainedRegistry::Get().map()) {
+		for (const auto& [base, _] : MaintainedRegistry::Get().entries()) {
 			const float adjCost = base->CalculateMagickaCost(nullptr) * Config::MaintainedExpMultiplier;
 			player->AddSkillExperience(base->GetAssociatedSkill(), adjCost);
 
@@ -1075,23 +1620,46 @@ namespace Maint
 	void MaintenanceOrchestrator::MaintainSpell(RE::SpellItem* const& baseSpell, RE::Actor* const& caster)
 	{
 		using namespace std;
+		MAINT_PROBE(kMaintainSpell);
 
-		spdlog::info("MaintainSpell({}, 0x{:08X})", baseSpell->GetName(), baseSpell->GetFormID());
+		// Notifications and the toggle list belong to the player; followers maintain silently
+		const bool isPlayer = caster->IsPlayerRef();
 
+		// Hand state and summon recasts are driven by player input, so NPCs keep self buffs only
+		if (!isPlayer && (IsBoundWeaponSpell(baseSpell) || IsSummonSpell(baseSpell))) {
+			return;
+		}
+
+		// Rejections are counted and logged by the policy
 		if (!SpellEligibilityPolicy::IsMaintainable(baseSpell, caster)) {
-			RE::DebugNotification(std::format("Cannot maintain {}.", baseSpell->GetName()).c_str());
+			if (isPlayer) {
+				RE::DebugNotification(std::format("Cannot maintain {}.", baseSpell->GetName()).c_str());
+			}
 			return;
 		}
 
-		const float baseCost = baseSpell->CalculateMagickaCost(caster);
-		const float magCost = UpkeepCostCalculator::Calculate(baseSpell, caster);
+		spdlog::info("MaintainSpell({}, 0x{:08X}) for {}", baseSpell->GetName(), baseSpell->GetFormID(), caster->GetName());
+
+		// Measured once; kept with the entry so later config changes can re-price without a recast
+		UpkeepCostCalculator::Inputs upkeep;
+		float magCost = 0.0f;
+		{
+			MAINT_PROBE(kUpkeepCost);
+			upkeep = UpkeepCostCalculator::Measure(baseSpell, caster);
+			UpkeepCostCalculator::PriceBatch(
+				{ &upkeep.baseCost, 1 }, { &upkeep.realDuration, 1 }, UpkeepCostCalculator::RegenMultiplier(caster), { &magCost, 1 });
+		}
+		const float baseCost = upkeep.baseCost;
 
 		if (magCost > caster->AsActorValueOwner()->GetActorValue(RE::ActorValue::kMagicka) + baseCost) {
-			RE::DebugNotification(std::format("Need {} Magicka to maintain {}.", static_cast<uint32_t>(magCost), baseSpell->GetName()).c_str());
+			if (isPlayer) {
+				RE::DebugNotification(std::format("Need {} Magicka to maintain {}.", static_cast<uint32_t>(magCost), baseSpell->GetName()).c_str());
+			}
 			return;
 		}
 
-		if (MaintainedRegistry::Get().hasBase(baseSpell)) {
+		auto& registry = MaintainedRegistry::Acquire(caster);
+		if (registry.hasBase(baseSpell)) {
 			spdlog::info("\tAlready has constant version");
 			return;
 		}
@@ -1111,14 +1679,7 @@ namespace Maint
 		pair.infinite = maint;
 		pair.debuff = debuff;
 
-		pair.isConjureMinion = std::ranges::any_of(
-			baseSpell->effects,
-			[](RE::Effect* eff) {
-				return eff &&
-			           eff->baseEffect &&
-			           eff->baseEffect->GetArchetype() ==
-			               RE::EffectSetting::Archetype::kSummonCreature;
-			});
+		pair.isConjureMinion = SpellTemplateCache::Get(baseSpell).isConjure;
 
 		if (pair.isConjureMinion) {
 			spdlog::debug("{} is a Conjured Creature", baseSpell->GetName());
@@ -1143,27 +1704,48 @@ namespace Maint
 		}
 		caster->AddSpell(debuff);
 
-		MaintainedRegistry::Get().insert(baseSpell, pair);
-		FormsRepository::Get().FlstMaintainedSpellToggle->AddForm(baseSpell);
+		const auto entry = registry.insert(baseSpell, pair, upkeep);
+		UpkeepSupervisor::Track(caster, entry, baseSpell);
 
-		RE::DebugNotification(std::format("Maintaining {} for {} Magicka.", baseSpell->GetName(), static_cast<uint32_t>(magCost)).c_str());
+		if (isPlayer) {
+			FormsRepository::Get().FlstMaintainedSpellToggle->AddForm(baseSpell);
+			RE::DebugNotification(std::format("Maintaining {} for {} Magicka.", baseSpell->GetName(), static_cast<uint32_t>(magCost)).c_str());
+		}
 	}
 
 	void MaintenanceOrchestrator::PurgeAll()
 	{
 		spdlog::info("Purge()");
-		for (const auto& [_, v] : MaintainedRegistry::Get().map()) {
-			v.infinite->SetDelete(true);
-			v.debuff->SetDelete(true);
-		}
+		const auto releaseForms = [](MaintainedRegistry& registry) {
+			for (const auto& [_, v] : registry.entries()) {
+				SpellFormPool::Release(v.infinite);
+				SpellFormPool::Release(v.debuff);
+			}
+			registry.forEachDeferred([](RE::SpellItem* maintained, RE::SpellItem*, bool& erase) {
+				SpellFormPool::Release(maintained);
+				erase = true;
+			});
+		};
+
+		releaseForms(MaintainedRegistry::Get());
+		MaintainedRegistry::ForEachNPC([&](RE::ActorHandle, MaintainedRegistry& registry) {
+			releaseForms(registry);
+		});
+		SpellFormPool::LogStats();
+		EffectClonePool::LogStats();
+		SpellEligibilityPolicy::LogRejections();
+
 		FormsRepository::Get().FlstMaintainedSpellToggle->ClearData();
 		MaintainedRegistry::Get().clear();
+		MaintainedRegistry::ClearNPCs();
 		Allocator::Get().Clear();
+		Allocator::Clones().Clear();
 		UpkeepSupervisor::ClearCache();
 		EffectRestorer::Clear();
+		FXSilencer::Clear();
 	}
 
-	void MaintenanceOrchestrator::BuildActiveSpellsCache()
+	void MaintenanceOrchestrator::BuildActiveSpellsCache(bool restoreDebuffMagnitudes)
 	{
 		spdlog::info("BuildActiveSpellsCache()");
 		static const auto& player = RE::PlayerCharacter::GetSingleton();
@@ -1178,9 +1760,13 @@ namespace Maint
 				FormsRepository::Get().FlstMaintainedSpellToggle->AddForm(s);
 		}
 
-		// Restore debuff magnitudes from live aeffs
+		// Restore debuff magnitudes from live aeffs; v2 co-saves already carried them
+		if (!restoreDebuffMagnitudes) {
+			return;
+		}
+
 		const auto& effs = player->AsMagicTarget()->GetActiveEffectList();
-		for (const auto& [base, p] : MaintainedRegistry::Get().map()) {
+		for (const auto& [base, p] : MaintainedRegistry::Get().entries()) {
 			(void)base;
 			for (auto* a : *effs) {
 				if (a->spell == p.debuff && a->GetCasterActor().get() == player && a->effect == p.debuff->effects.front()) {
@@ -1192,62 +1778,216 @@ namespace Maint
 		}
 	}
 
-	void MaintenanceOrchestrator::ApplySilencedFXPostLoad()
+	void MaintenanceOrchestrator::ReconcileSilencedFX()
 	{
-		spdlog::debug("[MaintainedMagicNG] Post-load FX reconciliation started");
+		auto& policy = MaintainedRegistry::Get();
+
+		// Desired state is derived once per entry; only the difference is applied
+		std::vector<Domain::MaintainedPair*> silence;
+		std::vector<Domain::MaintainedPair*> unsilence;
+		const auto diff = [&](MaintainedRegistry& registry) {
+			for (auto&& [baseSpell, pair] : registry.entries()) {
+				if (!baseSpell || !pair.infinite) {
+					continue;
+				}
 
-		auto& registry = MaintainedRegistry::Get();
+				const bool desired = Config::DoSilenceFX || policy.shouldSilenceSpell(baseSpell);
+				if (desired != pair.fxSilenced) {
+					(desired ? silence : unsilence).push_back(&pair);
+				}
+			}
+		};
 
-		if (registry.empty()) {
-			spdlog::debug("[MaintainedMagicNG] No maintained spells to reconcile");
+		diff(policy);
+		MaintainedRegistry::ForEachNPC([&](RE::ActorHandle, MaintainedRegistry& registry) {
+			diff(registry);
+		});
+
+		if (silence.empty() && unsilence.empty()) {
+			spdlog::debug("[MaintainedMagicNG] Maintained spell FX already up to date");
 			return;
 		}
 
-		for (auto& [baseSpell, pair] : registry.map()) {
-			if (!baseSpell) {
-				continue;
+		FXSilencer::ApplyBatch(silence, unsilence);
+		spdlog::debug(
+			"[MaintainedMagicNG] FX reconciled: {} silenced, {} restored",
+			silence.size(),
+			unsilence.size());
+	}
+
+	void MaintenanceOrchestrator::RepriceUpkeep()
+	{
+		MAINT_PROBE(kUpkeepReprice);
+
+		std::vector<float> costs;
+		std::size_t changed = 0;
+
+		const auto reprice = [&](RE::Actor* caster, MaintainedRegistry& registry) {
+			if (!caster || registry.empty()) {
+				return;
 			}
 
-			RE::SpellItem* maintainedSpell = pair.infinite;
-			if (!maintainedSpell) {
-				continue;
+			// Entries restored from a v1 co-save carry no measured inputs; take the nominal
+			// duration, which is what a fresh cast would report for an unmodified spell
+			for (auto&& [base, baseCost, duration] : registry.upkeepInputs()) {
+				if (baseCost <= 0.0f) {
+					baseCost = base->CalculateMagickaCost(caster);
+					duration = base->effects.empty() ? 0.0f : static_cast<float>(base->effects.front()->GetDuration());
+				}
 			}
 
-			bool shouldSilenceFX = Config::DoSilenceFX || MaintainedRegistry::Get().shouldSilenceSpell(baseSpell);
+			costs.resize(registry.size());
+			UpkeepCostCalculator::PriceBatch(registry.upkeepBaseCosts(), registry.upkeepDurations(), UpkeepCostCalculator::RegenMultiplier(caster), costs);
 
-			if (!shouldSilenceFX) {
-				continue;
+			std::size_t i = 0;
+			for (const auto& [base, pair] : registry.entries()) {
+				const float cost = costs[i++];
+
+				// Each debuff owns its effect; the template and other debuffs are never touched
+				auto& charged = pair.debuff->effects.front()->effectItem.magnitude;
+				if (charged == cost) {
+					continue;
+				}
+
+				const float previous = charged;
+				charged = cost;
+				if (caster->HasSpell(pair.debuff)) {
+					caster->RemoveSpell(pair.debuff);
+					caster->AddSpell(pair.debuff);
+				}
+				++changed;
+				spdlog::debug("Re-priced {} for {}: {:.0f} -> {:.0f}", base->GetName(), caster->GetName(), previous, cost);
 			}
+		};
 
-			spdlog::debug(
-				"[MaintainedMagicNG] Post-load silencing maintained spell: {} (0x{:08X})",
-				baseSpell->GetName(),
-				baseSpell->GetFormID());
-			
-			FXSilencer::SilenceSpellFX(pair);
-		}
+		reprice(RE::PlayerCharacter::GetSingleton(), MaintainedRegistry::Get());
+		MaintainedRegistry::ForEachNPC([&](RE::ActorHandle handle, MaintainedRegistry& registry) {
+			reprice(handle.get().get(), registry);
+		});
 
-		spdlog::debug("[MaintainedMagicNG] Post-load FX reconciliation complete");
+		spdlog::info("RepriceUpkeep: {} debuff(s) updated", changed);
 	}
 
 	// ================= UpkeepSupervisor ==========================================
 
 	void UpkeepSupervisor::ClearCache(){
-		cache_.Clear();
+		for (std::size_t slot = 0; slot < loop_.size(); ++slot) {
+			loop_[slot].cache.Clear();
+		}
+		loop_.Clear();
+
+		const std::scoped_lock lock{ wakeMtx_ };
+		wakes_.clear();
 	}
-	void UpkeepSupervisor::ForceMaintainedSpellUpdate(RE::Actor* const& actor)
+
+	UpkeepSupervisor::Supervised& UpkeepSupervisor::Player()
 	{
-		if (MaintainedRegistry::Get().empty())
+		if (loop_.empty()) {
+			loop_[loop_.Add()].registry = &MaintainedRegistry::Get();
+		}
+		return loop_[0];
+	}
+
+	std::uint16_t UpkeepSupervisor::SlotFor(RE::Actor* actor)
+	{
+		Player();
+		if (actor->IsPlayerRef()) {
+			return 0;
+		}
+
+		const auto handle = actor->GetHandle();
+		for (std::size_t i = 1; i < loop_.size(); ++i) {
+			if (loop_[i].handle == handle) {
+				return static_cast<std::uint16_t>(i);
+			}
+		}
+
+		const auto slot = loop_.Add();
+		auto& added = loop_[slot];
+		added.handle = handle;
+		added.formID = actor->GetFormID();
+		added.registry = &MaintainedRegistry::Acquire(actor);
+		return slot;
+	}
+
+	// ================= UpkeepSupervisor::LoopTraits ==============================
+
+	RE::Actor* UpkeepSupervisor::LoopTraits::Resolve(std::uint16_t slot, Supervised& state)
+	{
+		RE::Actor* live = slot == 0 ? RE::PlayerCharacter::GetSingleton() : state.handle.get().get();
+		if (slot != 0 && live && (!live->Is3DLoaded() || live->IsDead())) {
+			live = nullptr;
+		}
+		if (live) {
+			state.cache.GetFor(live);
+		}
+		return live;
+	}
+
+	bool UpkeepSupervisor::LoopTraits::Validate(Supervised& state, RE::Actor* actor, MaintainedRegistry::Handle handle)
+	{
+		auto* pair = state.registry->get(handle);
+		if (!pair) {
+			return false;
+		}
+		ValidateEntry(actor, state.registry->baseOf(handle), *pair, state.cache);
+		return true;
+	}
+
+	void UpkeepSupervisor::LoopTraits::Sweep(Supervised& state, RE::Actor* actor)
+	{
+		SweepInvalid(actor, *state.registry);
+	}
+
+	bool UpkeepSupervisor::LoopTraits::Holds(const Supervised& state, MaintainedRegistry::Handle handle)
+	{
+		return state.registry->get(handle) != nullptr;
+	}
+
+	float UpkeepSupervisor::LoopTraits::CadenceOf(const Supervised& state, MaintainedRegistry::Handle handle)
+	{
+		return ValidationScheduler::CadenceFor(state.registry->baseOf(handle));
+	}
+
+	// Unloaded or dead; its entries wait for the load event
+	void UpkeepSupervisor::LoopTraits::Parked(const Supervised& state)
+	{
+		spdlog::debug("Parked maintained spells of 0x{:08X} until it loads", state.formID);
+	}
+
+	// ================= UpkeepSupervisor ==========================================
+
+	void UpkeepSupervisor::OnActorLoaded(RE::FormID formID)
+	{
+		if (loop_.parkedCount() == 0) {
 			return;
+		}
+		const std::scoped_lock lock{ wakeMtx_ };
+		wakes_.push_back(formID);
+	}
+
+	void UpkeepSupervisor::WakeLoaded()
+	{
+		std::vector<RE::FormID> wakes;
+		{
+			const std::scoped_lock lock{ wakeMtx_ };
+			wakes.swap(wakes_);
+		}
 
-		// Timing (rolling avg over window)
-		constexpr uint32_t WIN{ 100 };
-		static double acc{ 0.0 };
-		static uint32_t cnt{ 0 };
-		const auto start = std::chrono::high_resolution_clock::now();
+		for (const auto formID : wakes) {
+			for (std::size_t slot = 1; slot < loop_.size(); ++slot) {
+				if (loop_.parked(slot) && loop_[slot].formID == formID) {
+					spdlog::debug("0x{:08X} loaded; resuming its maintained spell checks", formID);
+					loop_.Reschedule(static_cast<std::uint16_t>(slot));
+				}
+			}
+		}
+	}
 
-		// Apply deferred dispels (bound weapon hand state)
-		MaintainedRegistry::Get().forEachDeferred([&](RE::SpellItem* maintained, RE::SpellItem* base, bool& erase) {
+	void UpkeepSupervisor::ApplyDeferredDispels(RE::Actor* actor, MaintainedRegistry& registry)
+	{
+		// Bound weapon hand state
+		registry.forEachDeferred([&](RE::SpellItem* maintained, RE::SpellItem* base, bool& erase) {
 			auto* eq = RE::ActorEquipManager::GetSingleton();
 			// 0=left, 1=right
 			if (actor->GetActorRuntimeData().selectedSpells[0] == maintained) {
@@ -1260,174 +2000,183 @@ namespace Maint
 				eq->EquipSpell(actor, base, RightHandSlot());
 				erase = true;
 			}
-		});
-
-		std::vector<std::pair<RE::SpellItem*, Domain::MaintainedPair>> toRemove;
-
-		for (auto& [base, pair] : MaintainedRegistry::Get().map()) {
-			if (FormsRepository::Get().GlobCleanupRequested->value != 0) {
-				spdlog::debug("Dispelled by player: {}", base->GetName());
-				toRemove.emplace_back(base, pair);
-				continue;
+			if (erase && !registry.find(base)) {
+				SpellFormPool::Release(maintained);
 			}
-			auto* m = pair.infinite;
-			auto* d = pair.debuff;
+		});
+	}
 
-			// Bound weapon validation
-			if (IsBoundWeaponSpell(base)) {
-				bool found = false;
-				const auto* right = actor->GetEquippedObject(false);
-
-				if (right && right->IsWeapon()) {
-					const auto* weap = right->As<RE::TESObjectWEAP>();
-					for (auto* eff : base->effects) {
-						if (weap->formID == eff->baseEffect->data.associatedForm->formID) {
-							found = true;
-							break;
-						}
+	void UpkeepSupervisor::ValidateEntry(RE::Actor* actor, RE::SpellItem* base, Domain::MaintainedPair& pair, const MaintainedEffectsCache& spell2ae)
+	{
+		auto* m = pair.infinite;
+		auto* d = pair.debuff;
+
+		// Bound weapon validation
+		if (IsBoundWeaponSpell(base)) {
+			bool found = false;
+			const auto* right = actor->GetEquippedObject(false);
+
+			if (right && right->IsWeapon()) {
+				const auto* weap = right->As<RE::TESObjectWEAP>();
+				for (auto* eff : base->effects) {
+					if (weap->formID == eff->baseEffect->data.associatedForm->formID) {
+						found = true;
+						break;
 					}
-					if (found)
-						continue;
-				} else {
-					auto* rSpell = actor->GetActorRuntimeData().selectedSpells[1];
-					if (rSpell == m && actor->HasSpell(d))
-						continue;
 				}
+				if (found)
+					return;
+			} else {
+				auto* rSpell = actor->GetActorRuntimeData().selectedSpells[1];
+				if (rSpell == m && actor->HasSpell(d))
+					return;
+			}
 
-				const auto* left = actor->GetEquippedObject(true);
-				if (left && left->IsWeapon()) {
-					const auto* weap = left->As<RE::TESObjectWEAP>();
-					for (auto* eff : base->effects) {
-						if (weap->formID == eff->baseEffect->data.associatedForm->formID) {
-							found = true;
-							break;
-						}
+			const auto* left = actor->GetEquippedObject(true);
+			if (left && left->IsWeapon()) {
+				const auto* weap = left->As<RE::TESObjectWEAP>();
+				for (auto* eff : base->effects) {
+					if (weap->formID == eff->baseEffect->data.associatedForm->formID) {
+						found = true;
+						break;
 					}
-					if (found)
-						continue;
-				} else {
-					auto* lSpell = actor->GetActorRuntimeData().selectedSpells[0];
-					if (lSpell == m && actor->HasSpell(d))
-						continue;
 				}
+				if (found)
+					return;
+			} else {
+				auto* lSpell = actor->GetActorRuntimeData().selectedSpells[0];
+				if (lSpell == m && actor->HasSpell(d))
+					return;
 			}
+		}
 
-			const auto& spell2ae = cache_.GetFor(actor);
-			const auto it = spell2ae.find(m);
+		const auto* found = spell2ae.find(m);
 
-			// Conjure Maintain check, will queue for resummon upon invalidation rather then dispell/unmaintain
-			if (pair.isConjureMinion) {
-				//recast is already queued. don't need to check anything
-				if (pair.recastQueued)
-					continue;
+		// Conjure Maintain check, will queue for resummon upon invalidation rather then dispell/unmaintain
+		if (pair.isConjureMinion) {
+			//recast is already queued. don't need to check anything
+			if (pair.recastQueued)
+				return;
 
-				bool summonMissing = false;
+			bool summonMissing = false;
 
-				//case 1. maintain spell is missing (usual case)
-				if (it == spell2ae.end()) {
-					spdlog::debug("Conjure {} missing", base->GetName());
-					summonMissing = true;
-				} else {
-					const auto& effSet = it->second;
+			//case 1. maintain spell is missing (usual case)
+			if (!found) {
+				spdlog::debug("Conjure {} missing", base->GetName());
+				summonMissing = true;
+			} else {
+				const auto& effSet = *found;
 
-					//case 2. one of the active effects are missing (some mods do this on conjure death instead)
-					if (m->effects.size() < effSet.size()) {
-						spdlog::debug("Conjure {} has too many effects, removing", base->GetName());
-						toRemove.emplace_back(base, pair);
-						continue;
-					} else if (m->effects.size() > effSet.size()) {
-						spdlog::debug("Conjure {} has too few effects", base->GetName());
-						summonMissing = true;
-					}
+				//case 2. one of the active effects are missing (some mods do this on conjure death instead)
+				if (m->effects.size() < effSet.size()) {
+					spdlog::debug("Conjure {} has too many effects, removing", base->GetName());
+					pair.markedForRemoval = true;
+					return;
+				} else if (m->effects.size() > effSet.size()) {
+					spdlog::debug("Conjure {} has too few effects", base->GetName());
+					summonMissing = true;
 				}
-				
-				//Conjure spell is invalid in some way. we will just assume it died and needs a resummon
-				if (summonMissing) {
-					spdlog::debug("Conjure {} missing — scheduling recast", base->GetName());
+			}
+			
+			//Conjure spell is invalid in some way. we will just assume it died and needs a resummon
+			if (summonMissing) {
+				spdlog::debug("Conjure {} missing — scheduling recast", base->GetName());
 
-					pair.recastQueued = true;
-					pair.recastRemaining = Config::ConjureRecastDelay;
-				}
-			} else {
-			// non-Conjure Maintain check. this is for all other kinds of spells
+				pair.recastQueued = true;
+				pair.recastRemaining = Config::ConjureRecastDelay;
+			}
+		} else {
+		// non-Conjure Maintain check. this is for all other kinds of spells
 
-				//case 1. maintain spell is missing
-				if (it == spell2ae.end()) {
-					spdlog::debug("{} not found on Actor", m->GetName());
-					toRemove.emplace_back(base, pair);
-					continue;
-				}
+			//case 1. maintain spell is missing
+			if (!found) {
+				spdlog::debug("{} not found on Actor", m->GetName());
+				pair.markedForRemoval = true;
+				return;
+			}
 
-				const auto& effSet = it->second;
+			const auto& effSet = *found;
 
-				//case 2. magic effect mis-match
+			//case 2. magic effect mis-match
 
-				if (m->effects.size() < effSet.size()) {
-					spdlog::trace("{} EFF mismatch: LESS", m->GetName());
-					toRemove.emplace_back(base, pair);
-					continue;
-				} else if (m->effects.size() > effSet.size()) {
-					spdlog::trace("{} EFF mismatch: MORE", m->GetName());
-
-					const auto getUniques = [](const RE::BSTArray<RE::Effect*>& arr) {
-						std::set<RE::TESForm*> uniq;
-						std::vector<RE::Effect*> out;
-						out.reserve(arr.size());
-						for (auto* item : arr) {
-							auto* assoc = item->baseEffect->data.associatedForm;
-							if (assoc && uniq.insert(assoc).second)
-								out.push_back(item);
-						}
-						return out;
-					};
-					const auto uniqueList = getUniques(m->effects);
+			if (m->effects.size() < effSet.size()) {
+				spdlog::trace("{} EFF mismatch: LESS", m->GetName());
+				pair.markedForRemoval = true;
+				return;
+			} else if (m->effects.size() > effSet.size()) {
+				spdlog::trace("{} EFF mismatch: MORE", m->GetName());
 
-					const auto wrongSrc = std::find_if(effSet.begin(), effSet.end(), [&](RE::ActiveEffect* e) {
-						return e->spell->As<RE::SpellItem>() != m;
-					});
-					if (wrongSrc != effSet.end()) {
-						spdlog::debug("\tSource mismatch; found at least one: {} (0x{:08X})",
-							(*wrongSrc)->spell->GetName(), (*wrongSrc)->spell->GetFormID());
-						toRemove.emplace_back(base, pair);
+				const auto wrongSrc = std::find_if(effSet.begin(), effSet.end(), [&](RE::ActiveEffect* e) {
+					return e->spell->As<RE::SpellItem>() != m;
+				});
+				if (wrongSrc != effSet.end()) {
+					spdlog::debug("\tSource mismatch; found at least one: {} (0x{:08X})",
+						(*wrongSrc)->spell->GetName(), (*wrongSrc)->spell->GetFormID());
+					pair.markedForRemoval = true;
+					return;
+				}
+
+				// Effects with a distinct associated form; spell effect lists are tiny, so no set
+				std::size_t uniqueCount = 0;
+				for (std::uint32_t i = 0; i < m->effects.size(); ++i) {
+					const auto* assoc = m->effects[i]->baseEffect->data.associatedForm;
+					if (!assoc) {
 						continue;
 					}
-					if (!uniqueList.empty() && uniqueList.size() > effSet.size()) {
-						spdlog::debug("\tExclusives are missing");
-						toRemove.emplace_back(base, pair);
-						continue;
+					bool seen = false;
+					for (std::uint32_t j = 0; j < i && !seen; ++j) {
+						seen = m->effects[j]->baseEffect->data.associatedForm == assoc;
 					}
-				} else {
-					constexpr uint32_t HUGE_DUR = 60 * 60 * 24 * 356;
-					const auto wrongDur = std::find_if(effSet.begin(), effSet.end(), [&](RE::ActiveEffect* e) {
-						return e->duration > 0.0 && static_cast<uint32_t>(e->duration - e->elapsedSeconds) < HUGE_DUR;
-					});
-					if (wrongDur != effSet.end()) {
-						spdlog::debug("EFF duration mismatch");
-						toRemove.emplace_back(base, pair);
-						continue;
+					if (!seen) {
+						++uniqueCount;
 					}
 				}
-
-				//case 3. no active effects on spell
-				const auto active = std::find_if(effSet.begin(), effSet.end(), [](RE::ActiveEffect* e) {
-					return !e->flags.any(RE::ActiveEffect::Flag::kInactive, RE::ActiveEffect::Flag::kDispelled);
+				if (uniqueCount > 0 && uniqueCount > effSet.size()) {
+					spdlog::debug("\tExclusives are missing");
+					pair.markedForRemoval = true;
+					return;
+				}
+			} else {
+				constexpr uint32_t HUGE_DUR = 60 * 60 * 24 * 356;
+				const auto wrongDur = std::find_if(effSet.begin(), effSet.end(), [&](RE::ActiveEffect* e) {
+					return e->duration > 0.0 && static_cast<uint32_t>(e->duration - e->elapsedSeconds) < HUGE_DUR;
 				});
-				if (active == effSet.end()) {
-					spdlog::debug("{} has zero actives", m->GetName());
-					toRemove.emplace_back(base, pair);
+				if (wrongDur != effSet.end()) {
+					spdlog::debug("EFF duration mismatch");
+					pair.markedForRemoval = true;
+					return;
 				}
 			}
+
+			//case 3. no active effects on spell
+			const auto active = std::find_if(effSet.begin(), effSet.end(), [](RE::ActiveEffect* e) {
+				return !e->flags.any(RE::ActiveEffect::Flag::kInactive, RE::ActiveEffect::Flag::kDispelled);
+			});
+			if (active == effSet.end()) {
+				spdlog::debug("{} has zero actives", m->GetName());
+				pair.markedForRemoval = true;
+			}
 		}
+	}
+
+	std::size_t UpkeepSupervisor::SweepInvalid(RE::Actor* actor, MaintainedRegistry& registry)
+	{
+		// Dispel everything ValidateEntry() marked in one pass, then patch the toggle list by delta
+		const bool isPlayer = actor->IsPlayerRef();
+		const auto slot = SlotFor(actor);
+		auto* toggleList = FormsRepository::Get().FlstMaintainedSpellToggle;
+		const std::size_t removed = registry.sweepMarked(
+			[&](RE::SpellItem* base, Domain::MaintainedPair& pair) {
+				loop_.Forget(slot, registry.find(base));
 
-		if (!toRemove.empty()) {
-			for (auto& [base, pair] : toRemove) {
 				auto* m = pair.infinite;
 				auto* d = pair.debuff;
-				spdlog::info("Dispelling missing/invalid {} (0x{:08X})", m->GetName(), m->GetFormID());
+				spdlog::info("Dispelling missing/invalid {} (0x{:08X}) on {}", m->GetName(), m->GetFormID(), actor->GetName());
 
-				if (IsBoundWeaponSpell(m) && !MaintainedRegistry::Get().isDeferred(m, base)) {
+				const bool deferred = IsBoundWeaponSpell(m);
+				if (deferred && !registry.isDeferred(m, base)) {
 					spdlog::debug("Deferring cleanup of {}", m->GetName());
-					MaintainedRegistry::Get().deferDispel(m, base);
+					registry.deferDispel(m, base);
 				}
 
 				if (actor->HasSpell(d)) {
@@ -1436,36 +2185,117 @@ namespace Maint
 					actor->RemoveSpell(m);
 					actor->RemoveSpell(d);
 
-					Allocator::Get().FreeFormID(m->GetFormID());
-					Allocator::Get().FreeFormID(d->GetFormID());
+					// A deferred bound weapon keeps its form until ApplyDeferredDispels() restores the hand
+					if (!deferred) {
+						SpellFormPool::Release(m);
+					}
+					SpellFormPool::Release(d);
 					if (Config::InstantDispel) {
-						static auto handle = actor->GetHandle();
+						auto handle = actor->GetHandle();
 						actor->AsMagicTarget()->DispelEffect(base, handle);
 					}
-					RE::DebugNotification(std::format("{} is no longer being maintained.", base->GetName()).c_str());
+					if (isPlayer) {
+						RE::DebugNotification(std::format("{} is no longer being maintained.", base->GetName()).c_str());
+					}
 				}
-				
-				MaintainedRegistry::Get().eraseBase(base);
+
+				if (isPlayer) {
+					RemoveAddedForm(toggleList, base);
+				}
+			});
+
+		return removed;
+	}
+
+	void UpkeepSupervisor::ForceMaintainedSpellUpdate(RE::Actor* const& actor)
+	{
+		auto* registry = MaintainedRegistry::Find(actor);
+		if (!registry || registry->empty()) {
+			// Nothing left to dispel; don't leave the request pending
+			if (actor->IsPlayerRef()) {
+				FormsRepository::Get().GlobCleanupRequested->value = 0;
+			}
+			return;
+		}
+
+		MAINT_PROBE(kForceUpdate);
+
+		const auto slot = SlotFor(actor);
+
+		ApplyDeferredDispels(actor, *registry);
+
+		const auto& spell2ae = loop_[slot].cache.GetFor(actor);
+
+		// The menu's "dispel all" is only honoured here, where every entry is visited
+		auto* cleanup = FormsRepository::Get().GlobCleanupRequested;
+		const bool dispelAll = slot == 0 && cleanup->value != 0;
+
+		for (auto&& [base, pair] : registry->entries()) {
+			if (dispelAll) {
+				spdlog::debug("Dispelled by player: {}", base->GetName());
+				pair.markedForRemoval = true;
+				continue;
 			}
+			ValidateEntry(actor, base, pair, spell2ae);
+		}
+
+		SweepInvalid(actor, *registry);
+		if (dispelAll) {
+			cleanup->value = 0;
+		}
+
+		// Every entry was just checked; restart each one's cadence from now
+		if (slot == 0) {
+			loop_.ClearRequests();
+		}
+		loop_.Reschedule(slot);
+	}
+
+	void UpkeepSupervisor::ValidateScheduled(float deltaSeconds)
+	{
+		auto& player = Player();
+		auto* pc = RE::PlayerCharacter::GetSingleton();
+
+		if (loop_.parkedCount() != 0) {
+			WakeLoaded();
+		}
+
+		// Deferred bound weapon restores wait on hand state, not on any cadence
+		if (player.registry->hasDeferred()) {
+			ApplyDeferredDispels(pc, *player.registry);
+		}
 
-			FormsRepository::Get().FlstMaintainedSpellToggle->ClearData();
-			for (const auto& [spl, _] : MaintainedRegistry::Get().map())
-				FormsRepository::Get().FlstMaintainedSpellToggle->AddForm(spl);
-			FormsRepository::Get().GlobCleanupRequested->value = 0;
+		// Effects lost by a maintained spell pull it forward to this frame
+		if (MaintainedEffectsCache::HasPendingDeltas() && !player.registry->empty()) {
+			player.cache.GetFor(pc);
+			player.cache.TakeRemovals(removals_);
+			for (auto* maintained : removals_) {
+				RequestCheck(player.registry->findByMaintained(maintained));
+			}
+			removals_.clear();
 		}
 
-		const auto end = std::chrono::high_resolution_clock::now();
-		std::chrono::duration<double> dur = end - start;
-		acc += dur.count();
-		++cnt;
-		if (cnt == WIN) {
-			const auto ms = (1000.0 * acc) / cnt;
-			spdlog::info("ForceMaintainedSpellUpdate() avg time: {:.3f}ms", ms);
-			acc = 0.0;
-			cnt = 0;
+		// One wheel for every actor: the per-frame cost follows the checks that fell due,
+		// not the number of followers
+		loop_.Pass(deltaSeconds, {
+			.enabled = Config::FrameBudgetEnabled,
+			.entries = static_cast<std::size_t>((std::max)(Config::FrameBudgetEntries, 1L)),
+			.time = std::chrono::microseconds(Config::FrameBudgetMicroseconds),
+		});
+	}
+
+	void UpkeepSupervisor::Track(RE::Actor* actor, MaintainedRegistry::Handle handle, const RE::SpellItem* base)
+	{
+		if (handle) {
+			loop_.Schedule(SlotFor(actor), handle, ValidationScheduler::CadenceFor(base));
 		}
 	}
 
+	void UpkeepSupervisor::RequestCheck(MaintainedRegistry::Handle handle)
+	{
+		loop_.RequestCheck(handle);
+	}
+
 	void UpkeepSupervisor::SetEvictionTick(RE::Actor* actor)
 	{
 		if (!actor) {
@@ -1474,10 +2304,9 @@ namespace Maint
 
 		evictionSnapshot_.clear();
 
-		const auto& activeEffects = cache_.GetFor(actor);
-		auto& registry = MaintainedRegistry::Get().map();
+		const auto& activeEffects = Player().cache.GetFor(actor);
 
-		for (const auto& [baseSpell, pair] : registry) {
+		for (const auto& [baseSpell, pair] : MaintainedRegistry::Get().entries()) {
 			if (!pair.isConjureMinion) {
 				continue;
 			}
@@ -1508,10 +2337,9 @@ namespace Maint
 			return;
 		}
 
-		const auto& activeEffects = cache_.GetFor(actor);
-		auto& registry = MaintainedRegistry::Get().map();
+		const auto& activeEffects = Player().cache.GetFor(actor);
 
-		for (auto& [baseSpell, pair] : registry) {
+		for (auto&& [baseSpell, pair] : MaintainedRegistry::Get().entries()) {
 			if (!pair.isConjureMinion) {
 				continue;
 			}
@@ -1558,7 +2386,7 @@ namespace Maint
 			return;
 		}
 
-		for (auto& [baseSpell, pair] : registry.map()) {
+		for (auto&& [baseSpell, pair] : registry.entries()) {
 			if (!pair.NeedsRecastUpdate()) {
 				continue;
 			}
@@ -1637,13 +2465,12 @@ namespace Maint
 
 		spdlog::debug("Triggered Mind Crush");
 
-		const auto& map = MaintainedRegistry::Get().map();
-		const float totalDrain = std::accumulate(map.begin(), map.end(), 0.0f,
-			[](float cur, const std::pair<RE::SpellItem* const, Domain::MaintainedPair>& e) {
-				return cur + e.second.debuff->effects.front()->GetMagnitude();
-			});
+		float totalDrain = 0.0f;
+		for (const auto& [_, pair] : MaintainedRegistry::Get().entries()) {
+			totalDrain += pair.debuff->effects.front()->GetMagnitude();
+		}
 
-		for (const auto& [base, pair] : MaintainedRegistry::Get().map()) {
+		for (const auto& [base, pair] : MaintainedRegistry::Get().entries()) {
 			if (IsBoundWeaponSpell(base)) {
 				MaintainedRegistry::Get().deferDispel(pair.infinite, base);
 			}
@@ -1652,6 +2479,38 @@ namespace Maint
 		actor->GetMagicCaster(RE::MagicSystem::CastingSource::kLeftHand)->CastSpellImmediate(mindCrush, false, actor, 1.0, true, totalDrain, nullptr);
 	}
 
+	void UpkeepSupervisor::CheckNPCUpkeepValidity()
+	{
+		// Mind Crush's script shows the player's help message, so followers get its effect
+		// directly: a stagger and every maintained spell swept at once
+		for (std::size_t slot = 1; slot < loop_.size(); ++slot) {
+			auto& state = loop_[slot];
+			if (loop_.parked(slot) || state.registry->empty()) {
+				continue;
+			}
+
+			auto* actor = state.handle.get().get();
+			if (!actor || !actor->Is3DLoaded() || actor->IsDead()) {
+				continue;
+			}
+			if (actor->AsActorValueOwner()->GetActorValue(RE::ActorValue::kMagicka) >= 0) {
+				continue;
+			}
+			if (actor->GetRace() == FormsRepository::Get().WerewolfBeastRace() ||
+				actor->GetRace() == FormsRepository::Get().VampireBeastRace()) {
+				continue;
+			}
+
+			spdlog::debug("Triggered Mind Crush on {}", actor->GetName());
+
+			for (auto&& [_, pair] : state.registry->entries()) {
+				pair.markedForRemoval = true;
+			}
+			SweepInvalid(actor, *state.registry);
+			actor->NotifyAnimationGraph("staggerStart");
+		}
+	}
+
 	// ================= SaveLoadingService ========================================
 
 	namespace SaveLoadingService
@@ -1715,6 +2574,8 @@ namespace Maint
 		// "MAINTAINEDMAGICNEWGENCOOKIESAVE:"
 		constexpr std::size_t MTMG_MAGIC_LEN = sizeof(MTMG_MAGIC) - 1;
 
+		// ---- v1 layout: header, then per entry { u32 nameLen, name, MaintainedSpellEntry } ----
+
 		struct MaintainedSpellHeader
 		{
 			char magic_cookie[32];     // fixed identifier
@@ -1762,25 +2623,290 @@ namespace Maint
 			return true;
 		}
 
-		void ParseMaintainedMagicBlob(const std::vector<std::byte>& buffer, std::size_t offset)
+		// ---- v2 layout: header, file table { u16 len, name }[fileCount], CosaveOwnerV2[ownerCount],
+		//      CosaveEntryV2[entryCount]. The player's entries come first, then each owner's in turn. ----
+
+		constexpr std::uint8_t kCosaveVersion = 2;
+		constexpr std::uint8_t kV2Marker = 0xFF;          // sits where v1 keeps its entry count (<= 32)
+		constexpr std::uint16_t kVirtualFile = 0xFFFF;    // runtime-created base spell; baseID is a full FormID
+
+		struct CosaveHeaderV2
 		{
-			const std::size_t size = buffer.size();
-			std::size_t cursor = offset;
+			char magic_cookie[32];      // MTMG_MAGIC, shared with v1 so the fallback scan finds both
+			std::uint32_t headerCRC;    // CRC32C of the fields after this one
+			std::uint8_t marker;        // kV2Marker
+			std::uint8_t version;       // kCosaveVersion
+			std::uint16_t fileCount;
+			std::uint16_t ownerCount;   // NPCs with maintained spells
+			std::uint16_t reserved;
+			std::uint32_t entryCount;   // player's and every owner's
+			std::uint32_t payloadSize;  // file table + owner table + entries
+			std::uint32_t payloadCRC;   // CRC32C of the payload
+		};
+		static_assert(std::is_trivially_copyable_v<CosaveHeaderV2>);
+		static_assert(sizeof(CosaveHeaderV2) == 56);
+		static_assert(offsetof(CosaveHeaderV2, marker) == offsetof(MaintainedSpellHeader, entryCount));
 
-			auto require = [&](std::size_t n) {
-				return cursor + n <= size;
+		struct CosaveEntryV2
+		{
+			enum Flag : std::uint8_t
+			{
+				kConjureMinion = 1 << 0,
+				kRecastQueued = 1 << 1,
 			};
 
-			// --------------------------------
-			// Header
-			// --------------------------------
+			RE::FormID baseID;  // local to fileIndex, or full when fileIndex == kVirtualFile
+			RE::FormID maintainedID;
+			RE::FormID debuffID;
+			float debuffMagnitude;
+			float recastRemaining;
+			float upkeepBaseCost;  // pricing inputs measured at the original cast
+			float upkeepDuration;
+			std::uint16_t fileIndex;
+			std::uint8_t flags;
+			std::uint8_t reserved;
+		};
+		static_assert(std::is_trivially_copyable_v<CosaveEntryV2>);
+		static_assert(sizeof(CosaveEntryV2) == 32);
+
+		// A follower whose maintained spells follow the player's entries
+		struct CosaveOwnerV2
+		{
+			RE::FormID actorID;  // local to fileIndex, or full when fileIndex == kVirtualFile
+			std::uint16_t fileIndex;
+			std::uint16_t entryCount;
+		};
+		static_assert(std::is_trivially_copyable_v<CosaveOwnerV2>);
+		static_assert(sizeof(CosaveOwnerV2) == 8);
+
+		std::uint32_t ComputeHeaderCRC(const CosaveHeaderV2& h)
+		{
+			constexpr auto kCovered = offsetof(CosaveHeaderV2, marker);
+			const auto bytes = std::as_bytes(std::span{ &h, 1 });
+			return Core::Crc32c(bytes.subspan(kCovered));
+		}
+
+		// Version of the record header at the start of `data`; 0 when it is not a valid header
+		std::uint8_t ProbeHeader(std::span<const std::byte> data)
+		{
+			if (data.size() < sizeof(MaintainedSpellHeader) ||
+				std::memcmp(data.data(), MTMG_MAGIC, MTMG_MAGIC_LEN) != 0) {
+				return 0;
+			}
+
+			if (static_cast<std::uint8_t>(data[offsetof(MaintainedSpellHeader, entryCount)]) != kV2Marker) {
+				MaintainedSpellHeader v1{};
+				std::memcpy(&v1, data.data(), sizeof(v1));
+				return IsValidHeader(v1) ? 1 : 0;
+			}
+
+			if (data.size() < sizeof(CosaveHeaderV2)) {
+				return 0;
+			}
+
+			CosaveHeaderV2 v2{};
+			std::memcpy(&v2, data.data(), sizeof(v2));
+			return v2.version == kCosaveVersion && v2.headerCRC == ComputeHeaderCRC(v2) ? kCosaveVersion : 0;
+		}
+
+		// One decoded co-save entry. Plain data only: the forms are resolved on the main thread.
+		struct CosaveEntry
+		{
+			std::uint16_t fileIndex{ kVirtualFile };
+			MaintainedSpellEntry ids{};
+
+			// v2 only
+			float debuffMagnitude{ 0.0f };
+			float recastRemaining{ 0.0f };
+			UpkeepCostCalculator::Inputs upkeep{};
+			std::uint8_t flags{ 0 };
+		};
+
+		struct CosaveOwner
+		{
+			std::uint16_t fileIndex{ kVirtualFile };
+			RE::FormID actorID{ 0 };
+			std::uint16_t entryCount{ 0 };
+		};
+
+		struct CosaveContents
+		{
+			std::uint8_t version{ 0 };
+			std::vector<std::string> files;  // interned plugin filenames, indexed by fileIndex
+			std::vector<CosaveOwner> owners;  // v2 only; their entries follow the player's, in order
+			std::vector<CosaveEntry> entries;
+
+			std::string_view FileOf(std::uint16_t fileIndex) const
+			{
+				return fileIndex < files.size() ? std::string_view{ files[fileIndex] } : "VIRTUAL"sv;
+			}
+			std::string_view FileOf(const CosaveEntry& e) const { return FileOf(e.fileIndex); }
+
+			std::size_t PlayerEntryCount() const
+			{
+				std::size_t owned = 0;
+				for (const auto& owner : owners) {
+					owned += owner.entryCount;
+				}
+				return entries.size() - owned;
+			}
+		};
+
+		std::optional<CosaveContents> DecodeV1(Core::SpanReader& in)
+		{
 			MaintainedSpellHeader hdr{};
-			std::memcpy(&hdr, buffer.data() + cursor, sizeof(hdr));
-			cursor += sizeof(hdr);
+			in.Read(hdr);
 
-			logger::info(
-				"MaintainedMagicNG header accepted: entries={}",
-				hdr.entryCount);
+			CosaveContents out{ .version = 1 };
+			out.entries.reserve(hdr.entryCount);
+
+			for (std::size_t i = 0; i < hdr.entryCount; ++i) {
+				std::uint32_t nameLen = 0;
+				in.Read(nameLen);
+				const auto filename = in.TakeString(nameLen);
+
+				auto& entry = out.entries.emplace_back();
+				in.Read(entry.ids);
+
+				if (!in.ok()) {
+					logger::error("v1 co-save record truncated at entry {}", i);
+					return std::nullopt;
+				}
+
+				if (filename != "VIRTUAL"sv) {
+					const auto it = std::ranges::find(out.files, filename);
+					entry.fileIndex = static_cast<std::uint16_t>(std::distance(out.files.begin(), it));
+					if (it == out.files.end()) {
+						out.files.emplace_back(filename);
+					}
+				}
+			}
+
+			return out;
+		}
+
+		std::optional<CosaveContents> DecodeV2(Core::SpanReader& in)
+		{
+			CosaveHeaderV2 hdr{};
+			in.Read(hdr);
+
+			const auto payload = in.Take(hdr.payloadSize);
+			if (!in.ok()) {
+				logger::error("v2 co-save record truncated (payload {} bytes)", hdr.payloadSize);
+				return std::nullopt;
+			}
+			if (Core::Crc32c(payload) != hdr.payloadCRC) {
+				logger::error("v2 co-save payload CRC mismatch");
+				return std::nullopt;
+			}
+
+			Core::SpanReader body{ payload };
+			CosaveContents out{ .version = kCosaveVersion };
+
+			out.files.reserve(hdr.fileCount);
+			for (std::uint16_t f = 0; f < hdr.fileCount; ++f) {
+				std::uint16_t nameLen = 0;
+				body.Read(nameLen);
+				out.files.emplace_back(body.TakeString(nameLen));
+			}
+
+			std::size_t owned = 0;
+			out.owners.reserve(hdr.ownerCount);
+			for (std::uint16_t o = 0; o < hdr.ownerCount; ++o) {
+				CosaveOwnerV2 raw{};
+				body.Read(raw);
+
+				if (raw.fileIndex != kVirtualFile && raw.fileIndex >= out.files.size()) {
+					logger::error("v2 co-save owner {} references missing file {}", o, raw.fileIndex);
+					return std::nullopt;
+				}
+
+				out.owners.push_back({ .fileIndex = raw.fileIndex, .actorID = raw.actorID, .entryCount = raw.entryCount });
+				owned += raw.entryCount;
+			}
+
+			// Entries are fixed width, so the count is checked before anything is allocated
+			if (!body.ok() || owned > hdr.entryCount ||
+				body.remaining() != std::size_t{ hdr.entryCount } * sizeof(CosaveEntryV2)) {
+				logger::error("v2 co-save payload malformed ({} entries, {} bytes left)", hdr.entryCount, body.remaining());
+				return std::nullopt;
+			}
+
+			out.entries.reserve(hdr.entryCount);
+			for (std::uint32_t i = 0; i < hdr.entryCount; ++i) {
+				CosaveEntryV2 raw{};
+				body.Read(raw);
+
+				if (raw.fileIndex != kVirtualFile && raw.fileIndex >= out.files.size()) {
+					logger::error("v2 co-save entry {} references missing file {}", i, raw.fileIndex);
+					return std::nullopt;
+				}
+
+				out.entries.push_back({
+					.fileIndex = raw.fileIndex,
+					.ids = { raw.baseID, raw.maintainedID, raw.debuffID },
+					.debuffMagnitude = raw.debuffMagnitude,
+					.recastRemaining = raw.recastRemaining,
+					.upkeep = { raw.upkeepBaseCost, raw.upkeepDuration },
+					.flags = raw.flags,
+				});
+			}
+
+			return out;
+		}
+
+		// `record` starts at our header and ends where the record does, when that is known;
+		// nothing past it is ever read
+		std::optional<CosaveContents> DecodeMaintainedMagicBlob(std::span<const std::byte> record)
+		{
+			const auto version = ProbeHeader(record);
+			if (version == 0) {
+				logger::error("MaintainedMagicNG header rejected: unknown format");
+				return std::nullopt;
+			}
+
+			logger::info("MaintainedMagicNG header accepted: format v{}", version);
+
+			Core::SpanReader in{ record };
+			auto contents = version == kCosaveVersion ? DecodeV2(in) : DecodeV1(in);
+
+			if (contents) {
+				for (const auto& [i, e] : std::views::enumerate(contents->entries)) {
+					logger::debug(
+						"Entry [{}]: file='{}', baseID=0x{:08X}, maint=0x{:08X}, debuff=0x{:08X}, magnitude={}, flags=0x{:02X}",
+						i,
+						contents->FileOf(e),
+						e.ids.baseLocalFormID,
+						e.ids.maintainedSpellID,
+						e.ids.debuffSpellID,
+						e.debuffMagnitude,
+						e.flags);
+				}
+			}
+			return contents;
+		}
+
+		// Set by the last restore when the co-save carried debuff magnitudes (v2), letting
+		// post-load skip the active effect scan that recovers them.
+		inline bool debuffMagnitudesRestored = false;
+
+		struct RestoredEntry
+		{
+			RE::Actor* owner;
+			RE::SpellItem* base;
+			float magnitude;  // < 0 when unknown
+		};
+
+		// Everything the last restore created
+		inline std::vector<RestoredEntry> restoredMagnitudes;
+
+		// Main thread only: creates the maintained/debuff forms and registers them with their
+		// owners. Followers' forms are recreated too, so the IDs their save data refers to are
+		// taken before the allocator can hand them to anyone else.
+		void RestoreEntries(const CosaveContents& contents)
+		{
+			restoredMagnitudes.clear();
+			restoredMagnitudes.reserve(contents.entries.size());
 
 			const auto& dataHandler = RE::TESDataHandler::GetSingleton();
 			if (!dataHandler) {
@@ -1788,48 +2914,53 @@ namespace Maint
 				return;
 			}
 
-			// --------------------------------
-			// Entries
-			// --------------------------------
-			for (std::size_t i = 0; i < hdr.entryCount; ++i) {
-				// filename length
-				std::uint32_t nameLen;
-				std::memcpy(&nameLen, buffer.data() + cursor, sizeof(nameLen));
-				cursor += sizeof(nameLen);
-
-				std::string filename(nameLen, '\0');
-				std::memcpy(filename.data(), buffer.data() + cursor, nameLen);
-				cursor += nameLen;
+			const bool hasRuntimeState = contents.version >= kCosaveVersion;
+
+			// Entries [0, PlayerEntryCount()) are the player's; each owner's range follows
+			RE::Actor* owner = RE::PlayerCharacter::GetSingleton();
+			std::size_t ownerIndex = 0;
+			std::size_t ownerEnd = contents.PlayerEntryCount();
+
+			for (const auto& [i, entry] : std::views::enumerate(contents.entries)) {
+				while (static_cast<std::size_t>(i) >= ownerEnd && ownerIndex < contents.owners.size()) {
+					const auto& next = contents.owners[ownerIndex++];
+					ownerEnd += next.entryCount;
+
+					owner = next.fileIndex != kVirtualFile ?
+					            dataHandler->LookupForm<RE::Actor>(next.actorID, contents.FileOf(next.fileIndex)) :
+					            RE::TESForm::LookupByID<RE::Actor>(next.actorID);
+					if (!owner) {
+						logger::warn(
+							"Skipping {} entries: unable to resolve actor {} 0x{:08X}",
+							next.entryCount,
+							contents.FileOf(next.fileIndex),
+							next.actorID);
+					}
+				}
 
-				// entry payload
-				MaintainedSpellEntry entry{};
-				std::memcpy(&entry, buffer.data() + cursor, sizeof(entry));
-				cursor += sizeof(entry);
+				if (!owner) {
+					continue;
+				}
 
-				logger::debug(
-					"Entry [{}]: file='{}', baseID=0x{:08X}, maint=0x{:08X}, debuff=0x{:08X}",
-					i,
-					filename,
-					entry.baseLocalFormID,
-					entry.maintainedSpellID,
-					entry.debuffSpellID);
+				const auto filename = contents.FileOf(entry);
+				const auto& ids = entry.ids;
 
 				// --------------------------------
 				// Resolve base spell (INI-equivalent)
 				// --------------------------------
 				RE::SpellItem* baseSpell = nullptr;
 
-				if (filename != "VIRTUAL") {
+				if (entry.fileIndex != kVirtualFile) {
 					// file-backed: baseLocalFormID is a LOCAL ID
 					baseSpell =
 						dataHandler->LookupForm<RE::SpellItem>(
-							entry.baseLocalFormID,
+							ids.baseLocalFormID,
 							filename);
 				} else {
 					// virtual: baseLocalFormID is actually a FULL FormID
 					baseSpell =
 						RE::TESForm::LookupByID<RE::SpellItem>(
-							entry.baseLocalFormID);
+							ids.baseLocalFormID);
 				}
 
 				if (!baseSpell) {
@@ -1837,7 +2968,7 @@ namespace Maint
 						"Skipping entry {}: unable to resolve base spell {} 0x{:08X}",
 						i,
 						filename,
-						entry.baseLocalFormID);
+						ids.baseLocalFormID);
 					continue;
 				}
 
@@ -1849,13 +2980,13 @@ namespace Maint
 				pair.infinite =
 					Maint::SpellFactory::CreateInfiniteFrom(
 						baseSpell,
-						entry.maintainedSpellID != 0x0 ? std::optional<RE::FormID>(entry.maintainedSpellID) : std::nullopt);
+						ids.maintainedSpellID != 0x0 ? std::optional<RE::FormID>(ids.maintainedSpellID) : std::nullopt);
 
 				if (!pair.infinite) {
 					logger::error(
 						"\tFailed to create Maintained Spell: {}",
 						baseSpell->GetName());
-					return;
+					continue;
 				}
 
 				// --------------------------------
@@ -1864,36 +2995,44 @@ namespace Maint
 				pair.debuff =
 					Maint::SpellFactory::CreateDebuffFrom(
 						baseSpell,
-						0.0f,
-						entry.debuffSpellID != 0x0 ? std::optional<RE::FormID>(entry.debuffSpellID) : std::nullopt);
+						entry.debuffMagnitude,
+						ids.debuffSpellID != 0x0 ? std::optional<RE::FormID>(ids.debuffSpellID) : std::nullopt);
 
 				if (!pair.debuff) {
 					logger::error(
 						"\tFailed to create Debuff Spell: {}",
 						baseSpell->GetName());
-					return;
+					SpellFormPool::Release(pair.infinite);
+					continue;
 				}
 
-				pair.isConjureMinion = std::ranges::any_of(
-					baseSpell->effects,
-					[](RE::Effect* eff) {
-						return eff &&
-					           eff->baseEffect &&
-					           eff->baseEffect->GetArchetype() ==
-					               RE::EffectSetting::Archetype::kSummonCreature;
-					});
+				if (hasRuntimeState) {
+					pair.isConjureMinion = (entry.flags & CosaveEntryV2::kConjureMinion) != 0;
+					pair.recastQueued = (entry.flags & CosaveEntryV2::kRecastQueued) != 0;
+					pair.recastRemaining = pair.recastQueued ? entry.recastRemaining : 0.0f;
+				} else {
+					pair.isConjureMinion = SpellTemplateCache::Get(baseSpell).isConjure;
+				}
 
 				// --------------------------------
 				// Insert into cache
 				// --------------------------------
-				MaintainedRegistry::Get().insert(
+				const auto handle = MaintainedRegistry::Acquire(owner).insert(
 					baseSpell,
-					pair);
+					pair,
+					entry.upkeep);
+				UpkeepSupervisor::Track(owner, handle, baseSpell);
+
+				restoredMagnitudes.push_back({ owner, baseSpell, hasRuntimeState ? entry.debuffMagnitude : -1.0f });
 			}
 
+			debuffMagnitudesRestored = hasRuntimeState;
+
 			logger::info(
-				"MaintainedMagicNG parse complete ({} entries)",
-				hdr.entryCount);
+				"MaintainedMagicNG restore complete ({} entries, {} followers, format v{})",
+				contents.entries.size(),
+				contents.owners.size(),
+				contents.version);
 		}
 
 		void ShowCenteredOKBox(const std::string& text)
@@ -2016,36 +3155,129 @@ namespace Maint
 						"Please specify the full path to your real saves folder in:\n\n") +
 					Config::PLUGIN_CONFIG;
 
-				ShowCenteredOKBox(message);
+				ShowCenteredOKBox(message);
+			}
+
+			// 4) Resolve final logical save root
+			std::filesystem::path resolved = myGames / localSavePath;
+
+			logger::debug(
+				"Resolved logical save root = '{}'",
+				resolved.string());
+
+			return resolved;
+		}
+
+		// Read-only view of a file mapped into memory; the OS pages in only what is touched
+		class MappedFile
+		{
+		public:
+			explicit MappedFile(const std::filesystem::path& path)
+			{
+				file_ = ::CreateFileW(
+					path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+				if (file_ == INVALID_HANDLE_VALUE) {
+					return;
+				}
+
+				LARGE_INTEGER size{};
+				if (!::GetFileSizeEx(file_, &size) || size.QuadPart <= 0) {
+					return;
+				}
+
+				mapping_ = ::CreateFileMappingW(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+				if (!mapping_) {
+					return;
+				}
+
+				view_ = ::MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0);
+				if (view_) {
+					size_ = static_cast<std::size_t>(size.QuadPart);
+				}
+			}
+
+			~MappedFile()
+			{
+				if (view_) {
+					::UnmapViewOfFile(view_);
+				}
+				if (mapping_) {
+					::CloseHandle(mapping_);
+				}
+				if (file_ != INVALID_HANDLE_VALUE) {
+					::CloseHandle(file_);
+				}
+			}
+
+			MappedFile(const MappedFile&) = delete;
+			MappedFile& operator=(const MappedFile&) = delete;
+
+			bool exists() const noexcept { return file_ != INVALID_HANDLE_VALUE; }
+
+			std::span<const std::byte> bytes() const noexcept
+			{
+				return { static_cast<const std::byte*>(view_), size_ };
 			}
 
-			// 4) Resolve final logical save root
-			std::filesystem::path resolved = myGames / localSavePath;
+		private:
+			HANDLE file_{ INVALID_HANDLE_VALUE };
+			HANDLE mapping_{ nullptr };
+			const void* view_{ nullptr };
+			std::size_t size_{ 0 };
+		};
 
-			logger::debug(
-				"Resolved logical save root = '{}'",
-				resolved.string());
+		inline const auto MaintainedMagicRecord = _byteswap_ulong('MTMG');
 
-			return resolved;
+		// Walks the SKSE co-save directory to the MTMG chunk, touching only the headers in
+		// between. Returns the chunk's data, or nullopt when no block of ours holds a chunk
+		// with a valid header so the caller can fall back to a scan.
+		std::optional<std::span<const std::byte>> FindRecordInDirectory(std::span<const std::byte> data)
+		{
+			using Core::CosaveDirectory::Status;
+
+			const auto found = Core::CosaveDirectory::FindChunk(
+				data, MaintainedMagicRecord, MaintainedMagicRecord,
+				[](std::span<const std::byte> chunk) { return ProbeHeader(chunk) != 0; });
+
+			if (found.rejected != 0) {
+				logger::warn("Skipped {} truncated or invalid MTMG chunk(s) in the co-save directory", found.rejected);
+			}
+
+			switch (found.status) {
+			case Status::kFound:
+				return found.chunk;
+			case Status::kNotCosave:
+				logger::warn("SKSE co-save header not recognised");
+				break;
+			case Status::kTruncated:
+				logger::warn("SKSE co-save directory truncated");
+				break;
+			case Status::kNotFound:
+				break;
+			}
+			return std::nullopt;
 		}
 
-		std::optional<std::size_t> FindMagicCookie(const std::vector<std::byte>& data)
+		std::optional<std::size_t> FindMagicCookie(std::span<const std::byte> data)
 		{
-			for (std::size_t i = 0;
-				i + sizeof(MaintainedSpellHeader) <= data.size();
-				++i) {
-				if (std::memcmp(
-						data.data() + i,
-						MTMG_MAGIC,
-						MTMG_MAGIC_LEN) != 0) {
-					continue;
-				}
-
-				const auto* header =
-					reinterpret_cast<const MaintainedSpellHeader*>(
-						data.data() + i);
+			if (data.size() < sizeof(MaintainedSpellHeader)) {
+				return std::nullopt;
+			}
 
-				if (!IsValidHeader(*header)) {
+			// Every candidate must leave room for a whole header
+			const std::size_t limit = data.size() - sizeof(MaintainedSpellHeader) + 1;
+			const std::string_view cookie{ MTMG_MAGIC, MTMG_MAGIC_LEN };
+			static const auto search = [] {
+				const auto fn = Core::PatternSearch::Select();
+				logger::debug("Co-save cookie search using {}", Core::PatternSearch::NameOf(fn));
+				return fn;
+			}();
+
+			for (std::size_t i = search(data, 0, limit, cookie);
+				i < limit;
+				i = search(data, i + 1, limit, cookie)) {
+				const auto version = ProbeHeader(data.subspan(i));
+				if (version == 0) {
 					logger::warn(
 						"Magic cookie match rejected (invalid header at offset {})",
 						i);
@@ -2053,11 +3285,9 @@ namespace Maint
 				}
 
 				logger::debug(
-					"Valid MaintainedMagic header found at offset {} "
-					"(entryCount={}, checksum=0x{:08X})",
+					"Valid MaintainedMagic header found at offset {} (format v{})",
 					i,
-					header->entryCount,
-					header->checksum);
+					version);
 
 				return i;
 			}
@@ -2067,65 +3297,134 @@ namespace Maint
 
 		std::mutex mtx;
 
-		void OnPreLoadGame_ScanCosave(const char* saveName)
+		// Locates and decodes our record. Touches no forms: it only reads the save path settings
+		// and the file itself.
+		std::optional<CosaveContents> ReadCosave(const std::string& saveName)
 		{
-			std::unique_lock<std::mutex> lock(mtx);
+			MAINT_PROBE(kCosaveScan);
 
 			const auto saveRoot = GetSaveRoot();
-			const auto cosaveName = MakeCoSaveName(saveName);
+			const auto cosaveName = MakeCoSaveName(saveName.c_str());
 			const auto cosavePath = saveRoot / cosaveName;
 
 			logger::debug(
 				"Attempting to open SKSE co-save '{}'",
 				cosavePath.string());
 
-			std::ifstream file(cosavePath, std::ios::binary | std::ios::ate);
-			if (!file) {
+			const MappedFile file(cosavePath);
+			if (!file.exists()) {
+				// Expected under MO2 profile saves; SKSE hands the record to the load callback
 				logger::info(
-					"No SKSE co-save found at '{}'",
+					"No SKSE co-save found at '{}'; maintained spells will be restored late, from the SKSE load callback",
 					cosavePath.string());
+				return std::nullopt;
+			}
 
-				std::string message =
-					"MaintainedMagicNG:\n"
-					"Unable to find SKSE co-save\n"
-					"Maintained spell will be broken and save is bricked!\n"
-					"Quit game and fix before continuing\n\n" +
-					cosavePath.string();
+			const auto buffer = file.bytes();
+			if (buffer.empty()) {
+				logger::warn("SKSE co-save is empty or could not be mapped");
+				return std::nullopt;
+			}
 
-				ShowCenteredOKBox(message);
-				return;
+			logger::debug("Mapped {} bytes of SKSE co-save", buffer.size());
+
+			// The directory bounds the record by its chunk length; a cookie match only by the file
+			auto record = FindRecordInDirectory(buffer);
+			if (!record) {
+				logger::info("MTMG record not located via co-save directory; scanning for magic cookie");
+				if (const auto found = FindMagicCookie(buffer)) {
+					record = buffer.subspan(*found);
+				}
+			}
+			if (!record) {
+				logger::warn("MaintainedMagicNG header not found in SKSE co-save");
+				return std::nullopt;
 			}
 
-			const std::streamsize size = file.tellg();
-			if (size <= 0) {
-				logger::warn("SKSE co-save is empty");
-				return;
+			logger::info(
+				"MaintainedMagicNG valid header found at offset {} ({} bytes)",
+				record->data() - buffer.data(),
+				record->size());
+
+			return DecodeMaintainedMagicBlob(*record);
+		}
+
+		using Milliseconds = std::chrono::duration<double, std::milli>;
+
+		// Returns false when the co-save could not be read; the load callback restores instead
+		bool OnPreLoadGame_ScanCosave(const char* saveName)
+		{
+			debuffMagnitudesRestored = false;
+			const auto start = std::chrono::steady_clock::now();
+			auto contents = ReadCosave(saveName);
+			const auto read = std::chrono::steady_clock::now();
+
+			std::unique_lock<std::mutex> lock(mtx);
+			if (contents) {
+				RestoreEntries(*contents);
 			}
 
-			file.seekg(0, std::ios::beg);
+			logger::info(
+				"Co-save restore (synchronous): read {:.2f} ms, restore {:.2f} ms, both on the main thread",
+				Milliseconds(read - start).count(),
+				Milliseconds(std::chrono::steady_clock::now() - read).count());
+			return contents.has_value();
+		}
+
+		struct Prefetched
+		{
+			std::optional<CosaveContents> contents;
+			double readMilliseconds{ 0.0 };
+		};
 
-			std::vector<std::byte> buffer(static_cast<std::size_t>(size));
-			if (!file.read(reinterpret_cast<char*>(buffer.data()), size)) {
-				logger::error("Failed to read SKSE co-save");
-				return;
+		std::future<Prefetched> prefetch;
+
+		// Starts reading the co-save on a worker thread. The engine keeps loading meanwhile;
+		// the revert callback joins it with FinishCosavePrefetch().
+		void BeginCosavePrefetch(std::string saveName)
+		{
+			prefetch = std::async(std::launch::async, [name = std::move(saveName)] {
+				const auto start = std::chrono::steady_clock::now();
+				auto contents = ReadCosave(name);
+				return Prefetched{ std::move(contents), Milliseconds(std::chrono::steady_clock::now() - start).count() };
+			});
+		}
+
+		// Waits for the worker and creates the forms on the calling (main) thread. False when
+		// nothing was prefetched or the co-save could not be read.
+		bool FinishCosavePrefetch()
+		{
+			if (!prefetch.valid()) {
+				return false;
 			}
 
-			logger::debug("Read {} bytes from SKSE co-save", buffer.size());
+			debuffMagnitudesRestored = false;
+			const auto start = std::chrono::steady_clock::now();
+			auto result = prefetch.get();
+			const auto joined = std::chrono::steady_clock::now();
 
-			const auto found = FindMagicCookie(buffer);
-			if (!found) {
-				logger::warn("MaintainedMagicNG header not found in SKSE co-save");
-				return;
+			std::unique_lock<std::mutex> lock(mtx);
+			if (result.contents) {
+				RestoreEntries(*result.contents);
 			}
 
 			logger::info(
-				"MaintainedMagicNG valid header found at offset {}",
-				*found);
+				"Co-save restore (async prefetch): read {:.2f} ms on a worker, main thread waited {:.2f} ms, restore {:.2f} ms",
+				result.readMilliseconds,
+				Milliseconds(joined - start).count(),
+				Milliseconds(std::chrono::steady_clock::now() - joined).count());
+			return result.contents.has_value();
+		}
 
-			ParseMaintainedMagicBlob(buffer, *found);
+		// A load that never reached the revert callback leaves its prefetch behind
+		void DropCosavePrefetch()
+		{
+			if (prefetch.valid()) {
+				prefetch.get();
+				logger::warn("Co-save prefetch was never joined; dropped");
+			}
 		}
 
-		inline const auto MaintainedMagicRecord = _byteswap_ulong('MTMG');
 		void OnGameSaved(SKSE::SerializationInterface* serde)
 		{
 			std::unique_lock<std::mutex> lock(mtx);
@@ -2135,79 +3434,248 @@ namespace Maint
 
 			logger::info("Saving data to SKSE co-save...");
 
-			const auto& map = MaintainedRegistry::Get().map();
+			// -------------------------------------------------
+			// Payload: interned file table, owner table, then fixed-width entries
+			// -------------------------------------------------
+			std::vector<std::string_view> files;
+			std::vector<CosaveOwnerV2> owners;
+			std::vector<CosaveEntryV2> entries;
 
-			if (map.empty()) {
-				logger::info("No spells being maintained; skipping save.");
-				return;
+			const auto internFile = [&](const RE::TESFile* file) {
+				if (!file) {
+					return kVirtualFile;
+				}
+				const std::string_view fileName = file->GetFilename();
+				const auto it = std::ranges::find(files, fileName);
+				const auto index = static_cast<std::uint16_t>(std::distance(files.begin(), it));
+				if (it == files.end()) {
+					files.push_back(fileName);
+				}
+				return index;
+			};
+
+			const auto collect = [&](RE::Actor* actor, MaintainedRegistry& registry) {
+				// Each debuff owns its effect, so the magnitude on it is the one being charged
+				for (const auto& [baseSpell, maintData, baseCost, duration] : registry.entriesWithUpkeep()) {
+					const auto* file = baseSpell->GetFile(0);
+
+					std::uint8_t flags = 0;
+					if (maintData.isConjureMinion) {
+						flags |= CosaveEntryV2::kConjureMinion;
+					}
+					if (maintData.recastQueued) {
+						flags |= CosaveEntryV2::kRecastQueued;
+					}
+
+					// Base ID is local for file-backed spells, full for runtime-created ones
+					entries.push_back({
+						.baseID = file ? baseSpell->GetLocalFormID() : baseSpell->GetFormID(),
+						.maintainedID = maintData.infinite->GetFormID(),
+						.debuffID = maintData.debuff->GetFormID(),
+						.debuffMagnitude = maintData.debuff->effects.front()->effectItem.magnitude,
+						.recastRemaining = maintData.recastRemaining,
+						.upkeepBaseCost = baseCost,
+						.upkeepDuration = duration,
+						.fileIndex = internFile(file),
+						.flags = flags,
+						.reserved = 0,
+					});
+
+					logger::debug(
+						"Entry written for {}: file='{}', baseID=0x{:08X}, maint=0x{:08X}, debuff=0x{:08X}, magnitude={}, flags=0x{:02X}",
+						actor->GetName(),
+						file ? file->GetFilename() : "VIRTUAL"sv,
+						entries.back().baseID,
+						entries.back().maintainedID,
+						entries.back().debuffID,
+						entries.back().debuffMagnitude,
+						flags);
+				}
+			};
+
+			if (auto* player = RE::PlayerCharacter::GetSingleton()) {
+				collect(player, MaintainedRegistry::Get());
 			}
 
-			if (map.size() > 32) {
-				logger::error(
-					"Too many maintained spells to save ({} > 32). Aborting save.",
-					map.size());
+			// Followers' maintained forms live in the same FormID range as the player's, so they
+			// are saved too; otherwise the IDs their save data refers to would be handed out again
+			MaintainedRegistry::ForEachNPC([&](RE::ActorHandle handle, MaintainedRegistry& registry) {
+				auto actor = handle.get();
+				if (!actor || registry.size() == 0) {
+					return;
+				}
+
+				const auto* file = actor->GetFile(0);
+				owners.push_back({
+					.actorID = file ? actor->GetLocalFormID() : actor->GetFormID(),
+					.fileIndex = internFile(file),
+					.entryCount = static_cast<std::uint16_t>(registry.size()),
+				});
+				collect(actor.get(), registry);
+			});
+
+			if (entries.empty()) {
+				logger::info("No spells being maintained; skipping save.");
 				return;
 			}
 
-			if (!serde->OpenRecord(MaintainedMagicRecord, 0)) {
-				logger::error("Failed to open MTMG record for writing.");
-				return;
+			std::vector<std::byte> payload;
+			const auto append = [&](const void* data, std::size_t size) {
+				const auto* bytes = static_cast<const std::byte*>(data);
+				payload.insert(payload.end(), bytes, bytes + size);
+			};
+
+			for (const auto fileName : files) {
+				const auto nameLen = static_cast<std::uint16_t>(fileName.size());
+				append(&nameLen, sizeof(nameLen));
+				append(fileName.data(), nameLen);
 			}
+			append(owners.data(), owners.size() * sizeof(CosaveOwnerV2));
+			append(entries.data(), entries.size() * sizeof(CosaveEntryV2));
 
 			// -------------------------------------------------
 			// Header
 			// -------------------------------------------------
-			MaintainedSpellHeader header{};
+			CosaveHeaderV2 header{};
 			std::memcpy(header.magic_cookie, MTMG_MAGIC, sizeof(header.magic_cookie));
-
-			header.entryCount = static_cast<std::uint8_t>(map.size());
-			std::memset(header.reserved, 0, sizeof(header.reserved));
-			header.checksum = ComputeHeaderChecksum(header);
+			header.marker = kV2Marker;
+			header.version = kCosaveVersion;
+			header.fileCount = static_cast<std::uint16_t>(files.size());
+			header.ownerCount = static_cast<std::uint16_t>(owners.size());
+			header.entryCount = static_cast<std::uint32_t>(entries.size());
+			header.payloadSize = static_cast<std::uint32_t>(payload.size());
+			header.payloadCRC = Core::Crc32c(payload);
+			header.headerCRC = ComputeHeaderCRC(header);
+
+			if (!serde->OpenRecord(MaintainedMagicRecord, kCosaveVersion)) {
+				logger::error("Failed to open MTMG record for writing.");
+				return;
+			}
 
 			serde->WriteRecordData(&header, sizeof(header));
+			serde->WriteRecordData(payload.data(), static_cast<std::uint32_t>(payload.size()));
 
-			// -------------------------------------------------
-			// Entries (Store()-equivalent semantics)
-			// -------------------------------------------------
-			for (auto& [baseSpell, maintData] : map) {
-					const auto* maintSpell = maintData.infinite;
-					const auto* debuffSpell = maintData.debuff;
+			logger::info(
+				"SKSE co-save write complete ({} entries, {} followers, {} files, {} bytes).",
+				header.entryCount,
+				header.ownerCount,
+				header.fileCount,
+				sizeof(header) + payload.size());
+		}
+
+		// Set when kPreLoadGame already restored from disk (the default), so the revert and
+		// load callbacks for the same load leave that state alone. Cleared at kPostLoadGame.
+		inline bool restoredFromDisk = false;
+
+		void OnRevert(SKSE::SerializationInterface*)
+		{
+			// The prefetch started at kPreLoadGame lands here, before the save's references are
+			// resolved; without a readable co-save the load callback restores instead
+			if (prefetch.valid()) {
+				restoredFromDisk = FinishCosavePrefetch();
+			}
+
+			if (restoredFromDisk) {
+				logger::debug("Revert: keeping state restored from disk");
+				return;
+			}
+
+			MaintenanceOrchestrator::PurgeAll();
+			restoredMagnitudes.clear();
+			debuffMagnitudesRestored = false;
+		}
 
-				const auto* file = baseSpell->GetFile(0);
+		void OnGameLoaded(SKSE::SerializationInterface* serde)
+		{
+			MAINT_PROBE(kCosaveScan);
 
-				// Match Store(): filename or "VIRTUAL"
-				const std::string_view fileName = file ? file->GetFilename() : "VIRTUAL"sv;
+			std::uint32_t type = 0;
+			std::uint32_t version = 0;
+			std::uint32_t length = 0;
+			std::vector<std::byte> buffer;
 
-				// Write filename length + bytes
-				const std::uint32_t nameLen = static_cast<std::uint32_t>(fileName.size());
+			while (serde->GetNextRecordInfo(type, version, length)) {
+				if (type != MaintainedMagicRecord) {
+					logger::warn("Unknown co-save record 0x{:08X} (v{}, {} bytes)", type, version, length);
+					continue;
+				}
 
-				serde->WriteRecordData(&nameLen, sizeof(nameLen));
-				if (nameLen > 0) {
-					serde->WriteRecordData(fileName.data(), nameLen);
+				if (restoredFromDisk) {
+					logger::debug("MTMG record already restored from disk; skipping");
+					continue;
 				}
 
-				// 🔑 Match Store(): base ID depends on file-backed vs virtual
-				const RE::FormID baseID = file ? baseSpell->GetLocalFormID() : baseSpell->GetFormID();
+				buffer.resize(length);
+				if (serde->ReadRecordData(buffer.data(), length) != length) {
+					logger::error("Failed to read MTMG record ({} bytes)", length);
+					continue;
+				}
 
-				MaintainedSpellEntry entry{
-					.baseLocalFormID = baseID,  // semantic rename aside
-					.maintainedSpellID = maintSpell->GetFormID(),
-					.debuffSpellID = debuffSpell->GetFormID()
-				};
+				if (ProbeHeader(buffer) == 0) {
+					logger::error("MTMG record header is invalid");
+					continue;
+				}
 
-				serde->WriteRecordData(&entry, sizeof(entry));
+				const auto contents = DecodeMaintainedMagicBlob(buffer);
 
-				logger::debug(
-					"Entry written: file='{}', baseID=0x{:08X}, maint=0x{:08X}, debuff=0x{:08X}",
-					fileName,
-					baseID,
-					entry.maintainedSpellID,
-					entry.debuffSpellID);
+				std::unique_lock<std::mutex> lock(mtx);
+				if (contents) {
+					RestoreEntries(*contents);
+				}
 			}
+		}
 
-			logger::info(
-				"SKSE co-save write complete ({} entries).",
-				header.entryCount);
+		// Late restore only (bCosaveLateRestore, or no co-save file): puts back maintained spells
+		// their owners lost because the forms did not exist yet when the save's references were
+		// resolved. Re-adding restarts those effects, so a pre-load restore never comes here.
+		void ReattachRestoredSpells()
+		{
+			if (restoredFromDisk || restoredMagnitudes.empty()) {
+				restoredMagnitudes.clear();
+				return;
+			}
+
+			const auto hasEffectsFrom = [](RE::Actor* actor, const RE::SpellItem* spell) {
+				for (auto* e : *actor->AsMagicTarget()->GetActiveEffectList()) {
+					if (e && e->spell == spell) {
+						return true;
+					}
+				}
+				return false;
+			};
+
+			for (const auto& [owner, base, magnitude] : restoredMagnitudes) {
+				auto* registry = MaintainedRegistry::Find(owner);
+				const auto* pair = registry ? registry->get(registry->find(base)) : nullptr;
+				if (!pair) {
+					continue;
+				}
+
+				// Pooled forms keep their FormID across loads, so the save may have bound the
+				// actor to one while it was still blank; that leaves the spell without effects
+				if (owner->HasSpell(pair->infinite)) {
+					if (hasEffectsFrom(owner, pair->infinite)) {
+						continue;
+					}
+					owner->RemoveSpell(pair->infinite);
+					owner->RemoveSpell(pair->debuff);
+				}
+
+				// Bound weapons were equipped, not added; validation releases them if they are gone
+				if (IsBoundWeaponSpell(base)) {
+					continue;
+				}
+
+				if (magnitude < 0.0f) {
+					pair->debuff->effects.front()->effectItem.magnitude = UpkeepCostCalculator::Calculate(base, owner);
+				}
+
+				logger::info("Re-attaching maintained {} to {}", base->GetName(), owner->GetName());
+				owner->AddSpell(pair->infinite);
+				owner->AddSpell(pair->debuff);
+			}
+
+			restoredMagnitudes.clear();
 		}
 	}
 
@@ -2223,6 +3691,11 @@ namespace Maint
 	{
 		UpdatePC(pc, delta);
 
+#if MAINT_PROFILING
+		Profiler::Tick(delta);
+#endif
+		MAINT_PROBE(kUpdatePC);
+
 		EffectRestorer::Update(delta);
 
 		TimerConjureWatch += delta;
@@ -2234,15 +3707,24 @@ namespace Maint
 			UpkeepSupervisor::UpdateConjureWatch(pc);
 			TimerConjureWatch = 0.0f;
 		}
-		if (TimerActiveEffCheck >= 0.50f) {
+		// A player-requested cleanup must reach every spell, not just those due this frame
+		if (FormsRepository::Get().GlobCleanupRequested->value != 0) {
 			UpkeepSupervisor::ForceMaintainedSpellUpdate(pc);
+		}
+
+		// Per-spell cadence for the player and every follower; frames with nothing due return almost immediately
+		UpkeepSupervisor::ValidateScheduled(delta);
+
+		if (TimerActiveEffCheck >= 0.50f) {
 			UpkeepSupervisor::CheckUpkeepValidity(pc);
+			UpkeepSupervisor::CheckNPCUpkeepValidity();
 			UpkeepSupervisor::UpdateConjureRecasts(pc, TimerActiveEffCheck);
 			TimerActiveEffCheck = 0.0f;
 		}
 		if (TimerExperienceAward >= 300) {
 			ExperienceService::AwardPlayerExperience(pc);
 			TimerExperienceAward = 0.0f;
+			Allocator::Clones().ReconcileWithCache();
 			Allocator::Get().ReconcileWithCache();  // let's also take a moment to reconcile the Allocator incase it lost track of something somehow
 		}
 	}
@@ -2264,12 +3746,20 @@ namespace Maint
 				return RE::BSEventNotifyControl::kContinue;
 
 			auto* caster = e->object->As<RE::Actor>();
-			if (caster != RE::PlayerCharacter::GetSingleton())
+			if (!caster)
+				return RE::BSEventNotifyControl::kContinue;
+
+			// Followers maintain what they cast while the player's maintain mode is on
+			if (!caster->IsPlayerRef() && !(Config::MaintainFollowerSpells && caster->IsPlayerTeammate()))
 				return RE::BSEventNotifyControl::kContinue;
 
 			if (static_cast<short>(FormsRepository::Get().GlobMaintainModeEnabled->value) == 0)
 				return RE::BSEventNotifyControl::kContinue;
 
+			// Spells ruled out at kDataLoaded stop at a bit test, before any form lookup
+			if (const auto eligible = SpellEligibilityPolicy::PreclassifiedEligible(e->spell); eligible && !*eligible)
+				return RE::BSEventNotifyControl::kContinue;
+
 			if (auto* spell = RE::TESForm::LookupByID<RE::SpellItem>(e->spell)) {
 				MaintenanceOrchestrator::MaintainSpell(spell, caster);
 			}
@@ -2288,6 +3778,87 @@ namespace Maint
 		}
 	};
 
+	class ActiveEffectEventHandler : public RE::BSTEventSink<RE::TESActiveEffectApplyRemoveEvent>
+	{
+	public:
+		RE::BSEventNotifyControl ProcessEvent(const RE::TESActiveEffectApplyRemoveEvent* e, RE::BSTEventSource<RE::TESActiveEffectApplyRemoveEvent>*) override
+		{
+			if (e && e->target)
+				MaintainedEffectsCache::OnEffectChanged(e->target->GetFormID(), e->activeEffectUniqueID, e->isApplied);
+
+			return RE::BSEventNotifyControl::kContinue;
+		}
+
+		static ActiveEffectEventHandler& GetSingleton()
+		{
+			static ActiveEffectEventHandler s;
+			return s;
+		}
+		static void Install()
+		{
+			RE::ScriptEventSourceHolder::GetSingleton()->AddEventSink<RE::TESActiveEffectApplyRemoveEvent>(&GetSingleton());
+		}
+	};
+
+	class ObjectLoadedEventHandler : public RE::BSTEventSink<RE::TESObjectLoadedEvent>
+	{
+	public:
+		RE::BSEventNotifyControl ProcessEvent(const RE::TESObjectLoadedEvent* e, RE::BSTEventSource<RE::TESObjectLoadedEvent>*) override
+		{
+			if (e && e->loaded)
+				UpkeepSupervisor::OnActorLoaded(e->formID);
+
+			return RE::BSEventNotifyControl::kContinue;
+		}
+
+		static ObjectLoadedEventHandler& GetSingleton()
+		{
+			static ObjectLoadedEventHandler s;
+			return s;
+		}
+		static void Install()
+		{
+			RE::ScriptEventSourceHolder::GetSingleton()->AddEventSink<RE::TESObjectLoadedEvent>(&GetSingleton());
+		}
+	};
+
+	// Perk purchases and equipment change the caster's spell costs
+	class CasterChangeEventHandler :
+		public RE::BSTEventSink<RE::TESEquipEvent>,
+		public RE::BSTEventSink<RE::MenuOpenCloseEvent>
+	{
+	public:
+		RE::BSEventNotifyControl ProcessEvent(const RE::TESEquipEvent* e, RE::BSTEventSource<RE::TESEquipEvent>*) override
+		{
+			auto* actor = e && e->actor ? e->actor->As<RE::Actor>() : nullptr;
+			if (actor && (actor->IsPlayerRef() || actor->IsPlayerTeammate()))
+				SpellEligibilityPolicy::InvalidateCasterRules();
+
+			return RE::BSEventNotifyControl::kContinue;
+		}
+
+		RE::BSEventNotifyControl ProcessEvent(const RE::MenuOpenCloseEvent* e, RE::BSTEventSource<RE::MenuOpenCloseEvent>*) override
+		{
+			if (e && !e->opening && e->menuName == RE::StatsMenu::MENU_NAME)
+				SpellEligibilityPolicy::InvalidateCasterRules();
+
+			return RE::BSEventNotifyControl::kContinue;
+		}
+
+		static CasterChangeEventHandler& GetSingleton()
+		{
+			static CasterChangeEventHandler s;
+			return s;
+		}
+		static void Install()
+		{
+			RE::ScriptEventSourceHolder::GetSingleton()->AddEventSink<RE::TESEquipEvent>(&GetSingleton());
+			if (auto* ui = RE::UI::GetSingleton()) {
+				ui->AddEventSink<RE::MenuOpenCloseEvent>(&GetSingleton());
+			}
+		}
+	};
+
 	// ================= Lifecycle / Messaging =====================================
 
 	void ReloadFromMCM()
@@ -2387,6 +3958,29 @@ namespace Maint
 			spdlog::set_level(spdlog::level::debug);
 		}
 
+		if (!devIni->HasKey("CONFIG", "bCosaveLateRestore")) {
+			devIni->SetBoolValue(
+				"CONFIG",
+				"bCosaveLateRestore",
+				false,
+				"# Restore maintained spells from SKSE's load callback instead of reading the .skse\n"
+				"# co-save before the save loads. Skips one file read per load, but the spells are\n"
+				"# re-added after the load: their effects restart and maintained bound weapons are lost.\n"
+				"# The load callback is also used whenever the co-save file cannot be found.");
+		}
+		Config::CosaveLateRestore = devIni->GetBoolValue("CONFIG", "bCosaveLateRestore");
+
+		if (!devIni->HasKey("CONFIG", "iMaxFormIDs")) {
+			devIni->SetLongValue(
+				"CONFIG",
+				"iMaxFormIDs",
+				Config::MaxFormIDs,
+				"# Runtime FormIDs reserved for maintained spells (two per spell), up to 4096.\n"
+				"# Takes effect at startup; lowering it below what a save uses drops those spells on load.");
+		}
+		Config::MaxFormIDs = devIni->GetLongValue("CONFIG", "iMaxFormIDs");
+		Allocator::Get().Configure(static_cast<std::uint32_t>((std::max)(Config::MaxFormIDs, 2L)));
+
 		if (!devIni->HasKey("CONFIG", "SavesPath")) {
 			devIni->SetValue(
 				"CONFIG",
@@ -2402,6 +3996,88 @@ namespace Maint
 		const auto savesPath = devIni->GetValue("CONFIG", "SavesPath");
 		Config::SAVES_PATH = savesPath.empty() ? "disabled" : savesPath;
 
+		if (!devIni->HasKey("CONFIG", "bMaintainFollowerSpells")) {
+			devIni->SetBoolValue(
+				"CONFIG",
+				"bMaintainFollowerSpells",
+				false,
+				"# Followers keep the self buffs they cast while maintain mode is on, paying upkeep\n"
+				"# from their own Magicka. Saved with the player's in the co-save.");
+		}
+		Config::MaintainFollowerSpells = devIni->GetBoolValue("CONFIG", "bMaintainFollowerSpells");
+
+		if (!devIni->HasKey("CONFIG", "bFXRestoreRealTime")) {
+			devIni->SetBoolValue(
+				"CONFIG",
+				"bFXRestoreRealTime",
+				false,
+				"# Time silenced spell FX restore delays in real time instead of game time.\n"
+				"# Game time stops while the game is paused.");
+		}
+		Config::FXRestoreRealTime = devIni->GetBoolValue("CONFIG", "bFXRestoreRealTime");
+
+		if (!devIni->HasKey("CONFIG", "bCloneEffectSettings")) {
+			devIni->SetBoolValue(
+				"CONFIG",
+				"bCloneEffectSettings",
+				false,
+				"# Give each maintained spell its own copy of its magic effects, so silencing its FX\n"
+				"# never affects the normal cast or other spells. Copies use their own FormID range\n"
+				"# and do not count against iMaxFormIDs.");
+		}
+		Config::CloneEffectSettings = devIni->GetBoolValue("CONFIG", "bCloneEffectSettings");
+
+		//
+		// ---- Performance ----
+		//
+		constexpr const char* kPerformanceSection = "Performance";
+
+		if (!devIni->HasKey(kPerformanceSection, "bFrameBudget")) {
+			devIni->SetBoolValue(
+				kPerformanceSection,
+				"bFrameBudget",
+				false,
+				"# Spread maintained spell validation across frames instead of checking\n"
+				"# everything that is due at once. Smoother frame times, slightly later detection.");
+		}
+		if (!devIni->HasKey(kPerformanceSection, "iFrameBudgetEntries")) {
+			devIni->SetLongValue(
+				kPerformanceSection,
+				"iFrameBudgetEntries",
+				Config::FrameBudgetEntries,
+				"# Maximum maintained spells validated per frame when bFrameBudget is on.");
+		}
+		if (!devIni->HasKey(kPerformanceSection, "iFrameBudgetMicroseconds")) {
+			devIni->SetLongValue(
+				kPerformanceSection,
+				"iFrameBudgetMicroseconds",
+				Config::FrameBudgetMicroseconds,
+				"# Time cap per frame for validation when bFrameBudget is on. 0 = entries cap only.");
+		}
+
+		Config::FrameBudgetEnabled = devIni->GetBoolValue(kPerformanceSection, "bFrameBudget");
+		Config::FrameBudgetEntries = devIni->GetLongValue(kPerformanceSection, "iFrameBudgetEntries");
+		Config::FrameBudgetMicroseconds = devIni->GetLongValue(kPerformanceSection, "iFrameBudgetMicroseconds");
+
+		if (!devIni->HasKey(kPerformanceSection, "fProbeDumpInterval")) {
+			devIni->SetDoubleValue(
+				kPerformanceSection,
+				"fProbeDumpInterval",
+				Config::ProbeDumpInterval,
+				"# Seconds between timing probe dumps to the log (profiling builds only). 0 = on request only.");
+		}
+		Config::ProbeDumpInterval = static_cast<float>(devIni->GetDoubleValue(kPerformanceSection, "fProbeDumpInterval"));
+
+		if (!devIni->HasKey(kPerformanceSection, "bAsyncCosavePrefetch")) {
+			devIni->SetBoolValue(
+				kPerformanceSection,
+				"bAsyncCosavePrefetch",
+				Config::AsyncCosavePrefetch,
+				"# Read the SKSE co-save on a worker thread while the engine starts loading the save.\n"
+				"# Both modes log their read, wait and restore times for comparison.");
+		}
+		Config::AsyncCosavePrefetch = devIni->GetBoolValue(kPerformanceSection, "bAsyncCosavePrefetch");
+
 		devIni->Save();
 
 		//
@@ -2454,6 +4130,17 @@ namespace Maint
 				return RE::BSEventNotifyControl::kContinue;
 			}
 
+			MAINT_PROBE(kMCMEvent);
+
+#if MAINT_PROFILING
+			// On-demand dump; send from Papyrus with SendModEvent("MaintainedMagic_DumpProbes").
+			// The dump itself runs on the next UpdatePCMod tick
+			if (a_event->eventName == "MaintainedMagic_DumpProbes") {
+				Profiler::RequestDump();
+				return RE::BSEventNotifyControl::kContinue;
+			}
+#endif
+
 			// -------------------------------------------------
 			// Runtime spell list request (from MCM page open)
 			// -------------------------------------------------
@@ -2464,7 +4151,6 @@ namespace Maint
 				std::size_t index = 1;
 
 				auto& registry = MaintainedRegistry::Get();
-				const auto& map = registry.map();
 
 				auto* source = SKSE::GetModCallbackEventSource();
 				if (!source) {
@@ -2472,7 +4158,7 @@ namespace Maint
 					return RE::BSEventNotifyControl::kContinue;
 				}
 
-				for (auto& [baseSpell, pair] : map) {
+				for (const auto& [baseSpell, pair] : registry.entries()) {
 					if (index >= kMaxSlots) {
 						break;
 					}
@@ -2540,33 +4226,7 @@ namespace Maint
 
 			if (a_event->eventName == "MaintainedMagic_MCM_Close") {
 				SaveLoadingService::SaveSilencedFX();
-
-				auto& registry = MaintainedRegistry::Get();
-
-				for (auto& [baseSpell, pair] : registry.map()) {
-					if (!baseSpell || !pair.infinite) {
-						continue;
-					}
-
-					if (Config::DoSilenceFX) {
-						FXSilencer::SilenceSpellFX(pair);
-					} else {
-						// If FX were disabled → silence now
-						if (registry.shouldSilenceSpell(baseSpell)) {
-							spdlog::debug(
-								"[MaintainedMagicNG] Immediately silencing FX for maintained spell: {}",
-								baseSpell->GetName());
-
-							FXSilencer::SilenceSpellFX(pair);
-						} else {
-							spdlog::debug(
-								"[MaintainedMagicNG] Restoring FX (shader fallback only) for maintained spell: {}",
-								baseSpell->GetName());
-
-							FXSilencer::UnsilenceSpellFX(pair);
-						}
-					}
-				}
+				MaintenanceOrchestrator::ReconcileSilencedFX();
 
 				return RE::BSEventNotifyControl::kContinue;
 			}
@@ -2600,9 +4260,11 @@ namespace Maint
 				// --- Costs ---
 			} else if (id == "iCostBaseDuration:Costs") {
 				Config::CostBaseDuration = static_cast<long>(value);
+				MaintenanceOrchestrator::RepriceUpkeep();
 
 			} else if (id == "fUpkeepDurationExponent:Costs") {
 				Config::UpkeepDurationExponent = value;
+				MaintenanceOrchestrator::RepriceUpkeep();
 
 				// --- Experience ---
 			} else if (id == "fMaintainedExpMultiplier:Experience") {
@@ -2655,7 +4317,10 @@ namespace Maint
 			RegisterMCMListener();
 			break;
 		case SKSE::MessagingInterface::kDataLoaded:
+			SpellTemplateCache::Invalidate();
+			CasterChangeEventHandler::Install();  // the UI singleton exists from here on
 			ReadConfiguration();
+			SpellEligibilityPolicy::Preclassify();
 			HeartofMagic_Handler::RegisterXPSource();
 			break;
 		case SKSE::MessagingInterface::kPreLoadGame:
@@ -2664,16 +4329,46 @@ namespace Maint
 				std::string saveFile(bytes, msg->dataLen);
 				spdlog::info("Load : {}", saveFile);
 
+				if (Config::CosaveLateRestore) {
+					// Restored by the SKSE revert/load callbacks
+					break;
+				}
+
+				// Forms must exist before the engine resolves the save's references, or the
+				// player's maintained spells (and bound weapons) are dropped by the load
+				const auto start = std::chrono::steady_clock::now();
+				if (Config::AsyncCosavePrefetch) {
+					// The read overlaps the engine's own load work up to the revert callback,
+					// which joins it and creates the forms
+					SaveLoadingService::DropCosavePrefetch();
+					SaveLoadingService::BeginCosavePrefetch(saveFile);
+					MaintenanceOrchestrator::PurgeAll();
+					SaveLoadingService::restoredFromDisk = false;
+
+					const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+					spdlog::info("Pre-load took {:.2f} ms; co-save read continues on a worker", elapsed.count());
+					break;
+				}
+
 				MaintenanceOrchestrator::PurgeAll();
-				SaveLoadingService::OnPreLoadGame_ScanCosave(saveFile.c_str());
+				const bool restored = SaveLoadingService::OnPreLoadGame_ScanCosave(saveFile.c_str());
+
+				const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+				spdlog::info("Pre-load restore took {:.2f} ms", elapsed.count());
+
+				// Without the file (e.g. MO2 profile saves) the load callback takes over
+				SaveLoadingService::restoredFromDisk = restored;
 			}
 			break;
 		case SKSE::MessagingInterface::kNewGame:
 			MaintenanceOrchestrator::PurgeAll();
 			break;
 		case SKSE::MessagingInterface::kPostLoadGame:
-			MaintenanceOrchestrator::BuildActiveSpellsCache();
-			MaintenanceOrchestrator::ApplySilencedFXPostLoad();
+			SaveLoadingService::DropCosavePrefetch();
+			SaveLoadingService::ReattachRestoredSpells();
+			MaintenanceOrchestrator::BuildActiveSpellsCache(!SaveLoadingService::debuffMagnitudesRestored);
+			SaveLoadingService::restoredFromDisk = false;
+			MaintenanceOrchestrator::ReconcileSilencedFX();
 			break;
 		default:
 			break;
@@ -2686,12 +4381,16 @@ namespace Maint
 		auto* serde = SKSE::GetSerializationInterface();
 		serde->SetUniqueID(SaveLoadingService::MaintainedMagicRecord);
 		serde->SetSaveCallback(SaveLoadingService::OnGameSaved);
+		serde->SetLoadCallback(SaveLoadingService::OnGameLoaded);
+		serde->SetRevertCallback(SaveLoadingService::OnRevert);
 		logger::debug("Cosave serialization initialized.");
 	}
 
 	bool Load()
 	{
 		SpellCastEventHandler::Install();
+		ActiveEffectEventHandler::Install();
+		ObjectLoadedEventHandler::Install();
 		UpdatePCHook::Install();
 		InitializeSerialization();
 		RegisterMCMListener();
@@ -2,23 +2,34 @@
 
 #include <SimpleIni.h>
 
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <format>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <queue>
+#include <ranges>
 #include <set>
+#include <span>
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 // Heart of Magic API
 #include "SpellLearningAPI.h"
 
+#include "Core.hpp"
+
+#ifndef MAINT_PROFILING
+#	define MAINT_PROFILING 0
+#endif
+
 namespace Maint
 {
 	// ===== Global config values (backed by INI) ==================================
@@ -30,7 +41,10 @@ namespace Maint
 		inline constexpr const char* MCM_USER = "Data/MCM/Settings/MaintainedMagic.ini";
 
 		constexpr float kDefaultFXRestoreDelay = 0.75f;
+		constexpr std::uint32_t kFXRestoreMinFrames = 2;  // updates a silenced effect stays silenced, however long they take
 
+		inline long MaxFormIDs = 64;  // managed FormID range; two per maintained spell
+		inline bool CosaveLateRestore = false;  // restore from SKSE's load callback instead of reading the .skse file at kPreLoadGame
 		inline std::string SAVES_PATH = "disabled";
 		inline bool DoSilenceFX = false;
 		inline long CostBaseDuration = 60;  // seconds, neutral duration
@@ -44,6 +58,21 @@ namespace Maint
 
 		inline float MagickaRegenPenalty = 500.0f;    // softness constant
 
+		// Frame budget for supervisor work (plugin INI, [Performance])
+		inline bool FrameBudgetEnabled = false;
+		inline long FrameBudgetEntries = 4;         // registry entries validated per frame
+		inline long FrameBudgetMicroseconds = 150;  // wall-clock cap per frame; 0 disables the time cap
+
+		// Probe histogram dump period (plugin INI, [Performance]); only used with MAINT_PROFILING
+		inline float ProbeDumpInterval = 60.0f;  // seconds; 0 = only on request
+
+		// Read the co-save on a worker from kPreLoadGame until the revert callback (plugin INI, [Performance])
+		inline bool AsyncCosavePrefetch = true;
+
+		inline bool MaintainFollowerSpells = false;  // followers keep self buffs they cast while maintain mode is on
+		inline bool FXRestoreRealTime = false;       // FX restore delays run on the wall clock instead of unpaused game time
+		inline bool CloneEffectSettings = false;     // maintained spells get private copies of their magic effects
+
 
 		// Simple wrapper over SimpleIni with multi-instance cache by path.
 		class ConfigBase
@@ -86,6 +115,72 @@ namespace Maint
 		};
 	}  // namespace CONFIG
 
+	// ===== Instrumentation =======================================================
+
+#if MAINT_PROFILING
+	enum class Probe : std::uint8_t
+	{
+		kUpdatePC = 0,
+		kValidateScheduled,
+		kForceUpdate,
+		kCacheRebuild,
+		kUpkeepCost,
+		kMaintainSpell,
+		kCosaveScan,
+		kMCMEvent,
+		kUpkeepReprice,
+
+		kTotal
+	};
+
+	class Profiler
+	{
+	public:
+		static void Record(Probe probe, std::uint64_t ns) noexcept;
+
+		// Asks the next Tick to dump; safe from any thread
+		static void RequestDump() noexcept;
+
+		// Dumps every Config::ProbeDumpInterval seconds or when requested.
+		// Called only from UpdatePCMod, which owns sinceDump_
+		static void Tick(float deltaSeconds);
+
+	private:
+		// Logs p50/p95/p99/max per probe and starts a new window
+		static void Dump();
+
+		static inline std::array<Core::LatencyHistogram, static_cast<std::size_t>(Probe::kTotal)> histograms_{};
+		static inline std::atomic<bool> dumpRequested_{ false };
+		static inline float sinceDump_{ 0.0f };
+	};
+
+	class ScopedProbe
+	{
+	public:
+		explicit ScopedProbe(Probe probe) noexcept :
+			probe_(probe), start_(std::chrono::steady_clock::now())
+		{}
+
+		~ScopedProbe()
+		{
+			const auto elapsed = std::chrono::steady_clock::now() - start_;
+			Profiler::Record(probe_, static_cast<std::uint64_t>(
+				std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+		}
+
+		ScopedProbe(const ScopedProbe&) = delete;
+		ScopedProbe& operator=(const ScopedProbe&) = delete;
+
+	private:
+		Probe probe_;
+		std::chrono::steady_clock::time_point start_;
+	};
+
+#	define MAINT_PROBE(name) const ::Maint::ScopedProbe maintScopedProbe_{ ::Maint::Probe::name }
+#else
+#	define MAINT_PROBE(name) ((void)0)
+#endif
+
 	// ===== Heart of Magic handler ================================================
 
 	class HeartofMagic_Handler
@@ -131,44 +226,27 @@ namespace Maint
 			bool valid{ false };
 		};
 
-		struct SilencedEffect
-		{
-			// ---- Identity ----
-			RE::Effect* effect{ nullptr };             // runtime effect
-			RE::EffectSetting* baseEffect{ nullptr };  // defensive pointer
-
-			// ---- Silence state ----
-			FxSilenceMode silenceMode{ FxSilenceMode::kNone };
-
-			// ---- Persist toggle restore ----
-			bool hadFXPersist{ false };
-
-			// ---- Shader fallback restore ----
-			RE::TESEffectShader* shader{ nullptr };
-			EffectShaderAlphaState shaderAlpha{};
-		};
-
+		// Hot per-spell state swept by the supervisor every tick. Kept trivially copyable;
+		// what silencing changed on shared forms is tracked by FXSilencer.
 		struct MaintainedPair
 		{
 			InfiniteSpell* infinite{ nullptr };
 			DebuffSpell* debuff{ nullptr };
 
-			// ---- FX tracking ----
-			std::vector<SilencedEffect> silencedEffects;
+			// ---- Recast state ----
+			float recastRemaining{ 0.0f };  // seconds; <= 0 means inactive
+			bool recastQueued{ false };
 
 			// ---- Conjuration metadata ----
 			bool isConjureMinion{ false };
 
-			// ---- Recast state ----
-			float recastRemaining{ 0.0f };  // seconds; <= 0 means inactive
-			bool recastQueued{ false };
+			// ---- FX ----
+			bool fxSilenced{ false };  // holds references in the FXSilencer ledger
 
-			// Convenience
-			bool HasSilencedFX() const noexcept
-			{
-				return !silencedEffects.empty();
-			}
+			// ---- Supervisor sweep ----
+			bool markedForRemoval{ false };  // set during validation, consumed by sweepMarked()
 
+			// Convenience
 			bool NeedsRecastUpdate() const noexcept
 			{
 				return isConjureMinion && recastQueued;
@@ -191,6 +269,8 @@ namespace Maint
 			// Alternatively:
 			// return std::tie(a.infinite, a.debuff) < std::tie(b.infinite, b.debuff);
 		}
+
+		static_assert(std::is_trivially_copyable_v<MaintainedPair>);
 	}  // namespace Domain
 
 	// ===== Catalogs / Repositories ==============================================
@@ -228,31 +308,222 @@ namespace Maint
 	class SpellEligibilityPolicy
 	{
 	public:
+		// Every reason a spell can be turned down, in evaluation order
+		enum class Rule : std::uint8_t
+		{
+			// Caster independent; memoized per load-order spell by Preclassify
+			kNoEffects = 0,
+			kNotFireAndForget,
+			kScroll,
+			kEnchantment,
+			kShortDuration,
+			kNotSelfOrSummon,
+			kMaintainedKeyword,
+			kExcludedKeyword,
+			kAllyLinkKeyword,
+
+			// Depend on the caster, the allocator or the config
+			kNoFormIDs,
+			kTooCheap,  // memoized per caster until InvalidateCasterRules()
+			kBoundDisallowed,
+			kBoundDualEquipped,
+
+			kTotal,
+			kNone = kTotal
+		};
+
 		static bool IsMaintainable(RE::SpellItem* const& spell, RE::Actor* const& caster);
+
+		// First caster-independent rule the spell fails; Rule::kNone when it passes them all
+		static Rule StaticRejection(RE::SpellItem* spell);
+		static std::string_view Describe(Rule rule) noexcept;
+
+		// Perks or equipment changed; memoized cost verdicts are recomputed on next use
+		static void InvalidateCasterRules() noexcept { ++casterEpoch_; }
+		static std::uint32_t CasterEpoch() noexcept { return casterEpoch_; }
+
+		static void LogRejections();
+
+		// Runs the caster-independent rules over every loaded spell, in parallel (kDataLoaded)
+		static void Preclassify();
+
+		// Preclassified verdict by FormID; std::nullopt for spells created after kDataLoaded
+		static std::optional<bool> PreclassifiedEligible(RE::FormID formID) noexcept { return preclassified_.Lookup(formID); }
+
+	private:
+		static Rule Reject(Rule rule, bool fresh);
+
+		static inline Core::DenseIdFlags preclassified_;
+
+		static inline std::uint32_t casterEpoch_{ 1 };
+		static inline std::array<std::uint32_t, static_cast<std::size_t>(Rule::kTotal)> rejections_{};
+		static inline std::uint32_t preclassifiedRejections_{};  // replayed from preclassified_, rule not kept
 	};
 
 	class UpkeepCostCalculator
 	{
 	public:
+		// Per-spell pricing inputs, measured once when the spell is maintained
+		struct Inputs
+		{
+			float baseCost{ 0.0f };      // magicka cost after the caster's perks
+			float realDuration{ 0.0f };  // seconds the cast actually lasted; 0 = unknown, priced as neutral
+		};
+
 		static float Calculate(RE::SpellItem* const& baseSpell, RE::Actor* const& caster);
+
+		static Inputs Measure(RE::SpellItem* baseSpell, RE::Actor* caster);
+		static float RegenMultiplier(RE::Actor* caster);
+
+		// out[i] = upkeep for (baseCosts[i], durations[i]) under the current config; the duration
+		// scaling runs four spells at a time
+		static void PriceBatch(
+			std::span<const float> baseCosts,
+			std::span<const float> durations,
+			float regenMultiplier,
+			std::span<float> out);
 	};
 
 	// ===== Factories / Builders ==================================================
 
+	// What SpellFactory and the eligibility policy derive from a base spell alone. Built when a
+	// spell is first maintained, so it holds at most the spells that passed IsMaintainable.
+	// Dropped on data and configuration reload.
+	class SpellTemplateCache
+	{
+	public:
+		struct Template
+		{
+			RE::FormID formID{ 0 };                 // guards against a runtime form reusing the address
+			RE::BSFixedString maintainedName;       // "Maintained <name>"
+			std::vector<RE::BGSKeyword*> keywords;  // base keywords + cloak + maintained markers
+			float baseCost{ 0.0f };                 // magicka cost without a caster
+			bool isCloak{ false };
+			bool isConjure{ false };
+
+			// Caster-dependent cost verdict, valid for costCaster at costEpoch
+			mutable RE::FormID costCaster{ 0 };
+			mutable std::uint32_t costEpoch{ 0 };
+			mutable bool tooCheap{ false };
+		};
+
+		static const Template& Get(RE::SpellItem* base);
+		// nullptr when the spell has not been maintained since the last reload
+		static const Template* Find(const RE::SpellItem* base);
+		static void Invalidate();
+
+	private:
+		static Template Build(RE::SpellItem* base);
+
+		static inline std::unordered_map<const RE::SpellItem*, Template> templates_;
+	};
+
 	class SpellFactory
 	{
 	public:
-		static RE::Effect* CloneEffectWithoutVisuals(const RE::Effect* src);
 		static RE::SpellItem* CreateInfiniteFrom(RE::SpellItem* const& base, std::optional<RE::FormID> aFormID = std::nullopt);
 		static RE::SpellItem* CreateDebuffFrom(RE::SpellItem* const& base, float const& magnitude, std::optional<RE::FormID> aFormID = std::nullopt);
 	};
 
+	// Runtime SpellItems bound to the allocator's FormIDs. A released form is reset and kept for
+	// whichever spell gets that FormID next, instead of being deleted and re-created.
+	class SpellFormPool
+	{
+	public:
+		// Form for an already allocated FormID: the pooled one when there is one, else a new one
+		static RE::SpellItem* Acquire(RE::FormID formID);
+
+		// Resets the form and frees its FormID; the form stays in the pool
+		static void Release(RE::SpellItem* spell);
+
+		static void LogStats();
+
+	private:
+		static void Reset(RE::SpellItem* spell);
+
+		static inline std::unordered_map<RE::FormID, RE::SpellItem*> forms_;
+		static inline std::uint32_t hits_{ 0 };
+		static inline std::uint32_t misses_{ 0 };
+	};
+
+	// Private Effect/EffectSetting copies for maintained spells (Config::CloneEffectSettings), so
+	// silencing one never touches the base spell or anything else sharing its magic effect.
+	// Each clone takes a FormID from Allocator::Clones(); settings are pooled by FormID like
+	// SpellFormPool, Effects come from fixed blocks and are never freed back to the heap.
+	// Debuffs take plain Effect copies from the same blocks so each carries its own magnitude.
+	class EffectClonePool
+	{
+	public:
+		// Copy of `src` pointing at a cloned EffectSetting; nullptr when out of FormIDs
+		static RE::Effect* Clone(const RE::Effect* src);
+
+		// Copy of `src` that still points at src's EffectSetting; never fails
+		static RE::Effect* Copy(const RE::Effect* src);
+
+		// Returns a clone or copy to the pool (freeing a clone's FormID); no-op for anything else
+		static void Release(RE::Effect* effect);
+
+		// The effect a clone was copied from, or nullptr when `effect` is not a clone
+		static const RE::Effect* SourceOf(const RE::Effect* effect);
+
+		// Approximate heap footprint of one cloned effect
+		static std::size_t BytesPerClone(const RE::Effect* effect);
+
+		static void LogStats();
+
+	private:
+		static constexpr std::size_t kBlockEffects = 32;
+
+		static RE::EffectSetting* AcquireSetting(RE::FormID formID);
+		static RE::Effect* AcquireEffect();
+		static void Reset(RE::EffectSetting* setting);
+
+		static inline std::unordered_map<RE::FormID, RE::EffectSetting*> settings_;
+		static inline std::unordered_map<const RE::Effect*, const RE::Effect*> sources_;  // clone -> source
+		static inline std::unordered_set<const RE::Effect*> copies_;
+		static inline std::vector<std::unique_ptr<std::byte[]>> blocks_;
+		static inline std::vector<RE::Effect*> freeEffects_;
+		static inline std::size_t blockUsed_{ kBlockEffects };
+	};
+
 	class FXSilencer
 	{
 	public:
-		// Disable FXPersist on effects that are safe to silence and return the ones we changed.
+		// Disable FXPersist (or zero the shader alpha) on effects that are safe to silence.
+		// Effect settings and shaders are shared between spells, so each one is silenced once,
+		// reference-counted, and restored when the last maintained spell using it lets go.
 		static void SilenceSpellFX(Domain::MaintainedPair& pair);
 		static void UnsilenceSpellFX(Domain::MaintainedPair& pair);
+
+		// Unsilences then silences the given pairs, scheduling all FX restores in one batch
+		static void ApplyBatch(
+			std::span<Domain::MaintainedPair* const> silence,
+			std::span<Domain::MaintainedPair* const> unsilence);
+
+		// Forgets every silence without restoring anything (the forms are reloaded with the save)
+		static void Clear();
+
+	private:
+		struct EffectSilence
+		{
+			Domain::FxSilenceMode mode{ Domain::FxSilenceMode::kNone };
+			std::uint32_t refs{ 0 };
+		};
+
+		struct ShaderSilence
+		{
+			Domain::EffectShaderAlphaState original{};
+			std::uint32_t refs{ 0 };
+		};
+
+		static bool CanSilence(const RE::EffectSetting* base);
+		static void SilenceEffects(Domain::MaintainedPair& pair);  // queues restores in restores_
+		static void Acquire(RE::Effect* effect);
+		static void Release(RE::EffectSetting* base);
+
+		static inline std::unordered_map<RE::EffectSetting*, EffectSilence> effects_;
+		static inline std::unordered_map<RE::TESEffectShader*, ShaderSilence> shaders_;
+		static inline std::vector<RE::Effect*> restores_;  // persist toggles awaiting EffectRestorer
 	};
 
 	// ===== State / Registries ====================================================
@@ -260,28 +531,101 @@ namespace Maint
 	class MaintainedRegistry
 	{
 	public:
+		static constexpr std::size_t kExpectedEntries = 32;  // typical upper bound; reserve hint only
+
+		using Handle = Core::SlotHandle;
+
+		// The player's registry
 		static MaintainedRegistry& Get();
 
+		// Registry of any actor, keyed by its handle; the player resolves to Get().
+		// Find() returns nullptr for actors that never maintained anything.
+		static MaintainedRegistry* Find(RE::Actor* actor);
+		static MaintainedRegistry& Acquire(RE::Actor* actor);
+
+		// Calls fn(actorHandle, registry) for every non-player registry
+		template <class Fn>
+		static void ForEachNPC(Fn&& fn)
+		{
+			for (auto& [actor, registry] : npcs_) {
+				fn(actor, *registry);
+			}
+		}
+
+		// Drops every non-player registry; callers delete the maintained forms first
+		static void ClearNPCs();
+
 		// ===============================
 		// Maintained spell tracking
 		// ===============================
 		void clear();
 		bool empty();
+		std::size_t size() const noexcept { return table_.size(); }
 
 		bool hasBase(RE::SpellItem* base);
 
-		// Mutable access to pair
-		Domain::MaintainedPair* getByBase(RE::SpellItem* base);
+		Handle find(RE::SpellItem* base) const;
 
-		void insert(RE::SpellItem* base, Domain::MaintainedPair pair);
+		// Resolve a handle; nullptr when it is stale
+		Domain::MaintainedPair* get(Handle handle);
+		RE::SpellItem* baseOf(Handle handle) const;
+
+		// Reverse lookup by the maintained (infinite) spell
+		Handle findByMaintained(const RE::SpellItem* maintained) const;
+
+		Handle insert(
+			RE::SpellItem* base,
+			Domain::MaintainedPair pair,
+			UpkeepCostCalculator::Inputs upkeep = {});
 		void eraseBase(RE::SpellItem* base);
 
-		// Direct map access for iteration
-		std::unordered_map<RE::SpellItem*, Domain::MaintainedPair>& map();
+		// Dense iteration over (base, pair); entries move on erase, so do not erase mid-loop
+		auto entries() { return std::views::zip(table_.keys(), table_.column<kPair>()); }
+		auto entries() const { return std::views::zip(table_.keys(), table_.column<kPair>()); }
+
+		// Upkeep pricing inputs as plain columns, indexed like entries(), for batch pricing
+		std::span<float> upkeepBaseCosts() noexcept { return table_.column<kUpkeepBaseCost>(); }
+		std::span<float> upkeepDurations() noexcept { return table_.column<kUpkeepDuration>(); }
+		auto upkeepInputs() { return std::views::zip(table_.keys(), upkeepBaseCosts(), upkeepDurations()); }
+		auto entriesWithUpkeep() const
+		{
+			return std::views::zip(table_.keys(), table_.column<kPair>(), table_.column<kUpkeepBaseCost>(), table_.column<kUpkeepDuration>());
+		}
+
+		// Calls fn(base, pair) for every entry marked for removal, erasing each
+		// afterwards. Returns the number of entries removed.
+		template <class Fn>
+		std::size_t sweepMarked(Fn&& fn)
+		{
+			std::size_t removed = 0;
+
+			// Backwards, so swap-remove only ever pulls in entries already visited
+			const auto bases = table_.keys();
+			const auto pairs = table_.column<kPair>();
+			for (std::size_t i = table_.size(); i-- > 0;) {
+				if (!pairs[i].markedForRemoval) {
+					continue;
+				}
+
+				fn(bases[i], pairs[i]);
+				eraseAt(i);
+				++removed;
+			}
+			return removed;
+		}
 
 		// ===============================
 		// Silenced spell policy
 		// ===============================
+
+		// Transparent, so spell names are looked up without building a std::string
+		struct NameHash
+		{
+			using is_transparent = void;
+			std::size_t operator()(std::string_view name) const noexcept { return std::hash<std::string_view>{}(name); }
+		};
+		using SpellNameSet = std::unordered_set<std::string, NameHash, std::equal_to<>>;
+
 		void clearSilencedSpells();
 
 		void addSilencedSpell(const std::string& baseSpellName);
@@ -290,23 +634,37 @@ namespace Maint
 		bool shouldSilenceSpell(const std::string& baseSpellName);
 		bool shouldSilenceSpell(const RE::SpellItem* spell);
 
-		std::unordered_set<std::string>& silencedSpells();
+		SpellNameSet& silencedSpells();
 
 		// ===============================
 		// Deferred cleanups
 		// ===============================
 		void deferDispel(RE::SpellItem* maintained, RE::SpellItem* base);
 		bool isDeferred(RE::SpellItem* maintained, RE::SpellItem* base);
+		bool hasDeferred() const noexcept { return !deferred_.empty(); }
 
 		void forEachDeferred(
 			const std::function<void(RE::SpellItem*, RE::SpellItem*, bool& erase)>& fn);
 
 	private:
-		std::unordered_map<RE::SpellItem*, Domain::MaintainedPair> map_;
+		void eraseAt(std::size_t index);
+
+		// Columns of table_, keyed by base spell
+		enum Column : std::size_t
+		{
+			kPair,
+			kUpkeepBaseCost,
+			kUpkeepDuration
+		};
+		Core::DenseTable<RE::SpellItem*, Domain::MaintainedPair, float, float> table_;
+
 		std::set<std::pair<RE::SpellItem*, RE::SpellItem*>> deferred_;
-		std::unordered_set<std::string> silencedSpells_;
+		SpellNameSet silencedSpells_;
 
 		std::uint32_t LastMaxSummonCount_ = 1;
+
+		// Followers and other NPCs; a handful at most, so a flat list
+		static inline std::vector<std::pair<RE::ActorHandle, std::unique_ptr<MaintainedRegistry>>> npcs_;
 	};
 
 	// ===== FormID Allocator ====================================================
@@ -315,10 +673,11 @@ namespace Maint
 	{
 	public:
 		static constexpr RE::FormID FORMID_OFFSET_BASE = 0xFF03F000;
+		static constexpr RE::FormID CLONE_FORMID_OFFSET_BASE = 0xFF03E000;  // cloned EffectSettings; ends below FORMID_OFFSET_BASE + MIN_LOCAL_ID
 
 		static constexpr std::uint32_t MIN_LOCAL_ID = 1;
-		static constexpr std::uint32_t MAX_LOCAL_ID = 64;
-		static constexpr std::uint32_t TOTAL_IDS = 64;
+		static constexpr std::uint32_t DEFAULT_TOTAL_IDS = 64;
+		static constexpr std::uint32_t MAX_TOTAL_IDS = static_cast<std::uint32_t>(Core::TwoLevelBitmap::kMaxCapacity);
 
 		// ----------------------------
 		// Allocation interface
@@ -326,6 +685,12 @@ namespace Maint
 
 		static Allocator& Get();
 
+		// Separate range for EffectClonePool, so clones never take a FormID a co-save refers to
+		static Allocator& Clones();
+
+		// Sets the managed range to [MIN_LOCAL_ID, MIN_LOCAL_ID + totalIDs); only while nothing is allocated
+		bool Configure(std::uint32_t totalIDs);
+
 		std::optional<RE::FormID> AllocateFormID();
 		std::optional<RE::FormID> AllocateSpecificFormID(RE::FormID fullFormID);
 		void FreeFormID(RE::FormID fullFormID);
@@ -337,45 +702,74 @@ namespace Maint
 		void Clear();
 
 	private:
-		// ----------------------------
-		// Bitmask helpers
-		// ----------------------------
+		Allocator(RE::FormID base, std::uint32_t totalIDs);
 
-		static constexpr std::uint64_t FULL_MASK = ~0ull;
+		Core::IdRangeAllocator _ids;
+	};
 
-		std::uint64_t _allocatedMask{ 0 };
+	// Engine side of the per-actor effect index; the indexing itself lives in Core::EffectIndex
+	struct EngineEffects
+	{
+		using Actor = RE::Actor;
+		using Effect = RE::ActiveEffect;
+		using Spell = RE::SpellItem;
+		using Key = RE::FormID;
+		using Context = MaintainedRegistry*;
 
-		static std::uint32_t FindFirstFreeIndex(std::uint64_t mask);
-		static constexpr std::uint64_t BitForIndex(std::uint32_t index);
+		struct Classification
+		{
+			RE::SpellItem* spell{ nullptr };  // maintained spell the effect counts towards
+			bool pinned{ false };
+		};
 
-		void SetIndexAllocated(std::uint32_t index);
-		void ClearIndexAllocated(std::uint32_t index);
-		bool IsIndexAllocated(std::uint32_t index) const;
+#if MAINT_PROFILING
+		struct RebuildProbe
+		{
+			ScopedProbe probe{ Probe::kCacheRebuild };
+		};
+#else
+		struct RebuildProbe
+		{};
+#endif
 
-		void MarkReferenced(std::uint64_t& mask, RE::FormID fullFormID) const;
+		static RE::FormID KeyOf(RE::Actor* actor) { return actor->GetFormID(); }
+		static constexpr RE::FormID WatchedKey() noexcept { return 0x14; }  // the player
+		static MaintainedRegistry* ContextFor(RE::Actor* actor) { return MaintainedRegistry::Find(actor); }
 
-		// ----------------------------
-		// ID mapping
-		// ----------------------------
+		template <class Fn>
+		static void ForEachEffect(RE::Actor* actor, Fn&& fn)
+		{
+			for (auto* e : *actor->AsMagicTarget()->GetActiveEffectList()) {
+				if (e && !fn(e)) {
+					break;
+				}
+			}
+		}
+
+		static std::uint16_t IdOf(const RE::ActiveEffect* e) noexcept { return e->usUniqueID; }
+		static bool CameFrom(const RE::ActiveEffect* e, const RE::SpellItem* spell) noexcept { return e->spell && e->spell == spell; }
+		static void Pin(RE::ActiveEffect* e) noexcept { e->elapsedSeconds = 0.0f; }
 
-		static constexpr RE::FormID IndexToLocalID(std::uint32_t index);
-		static constexpr std::uint32_t LocalIDToIndex(RE::FormID localID);
-		static constexpr RE::FormID MakeFullFormID(RE::FormID localID);
-		static constexpr RE::FormID ExtractLocalID(RE::FormID fullFormID);
-		static constexpr bool IsInManagedRange(RE::FormID fullFormID);
+		// Registered pairs count towards their infinite spell; keyword-marked spells are pinned
+		static Classification Classify(MaintainedRegistry* registry, RE::ActiveEffect* e);
 	};
 
-	class MaintainedEffectsCache
+	using MaintainedEffectsCache = Core::EffectIndex<EngineEffects>;
+
+	// Wheel geometry and per-spell cadences of the supervisor's validation checks; every
+	// maintained spell carries its own next-check deadline
+	class ValidationScheduler
 	{
 	public:
-		const std::unordered_map<RE::SpellItem*, std::vector<RE::ActiveEffect*>>&
-			GetFor(RE::Actor* actor);
-		void Clear();
+		static constexpr float kTickSeconds = 0.05f;
+		static constexpr std::size_t kWheelSize = 64;  // 3.2 s horizon, longer delays clamp
 
-	private:
-		std::unordered_map<RE::SpellItem*, std::vector<RE::ActiveEffect*>> cache_{};
-		ptrdiff_t lastCount_{ 0 };
-		void rebuild(RE::Actor* actor);
+		// Per-archetype validation cadence (seconds)
+		static constexpr float kCadenceFast = 0.25f;  // bound weapons, conjures
+		static constexpr float kCadenceDefault = 0.5f;
+		static constexpr float kCadenceSlow = 2.0f;  // cloaks and other long-lived self buffs
+
+		static float CadenceFor(const RE::SpellItem* base);
 	};
 
 	// ===== Orchestration / Application Services =================================
@@ -388,21 +782,28 @@ namespace Maint
 			RE::Effect* effect,
 			float delaySeconds = Maint::Config::kDefaultFXRestoreDelay);
 
-		// Called every player update; decrements timers and restores FX when ready
+		// Push() for many effects sharing one deadline
+		static void PushBatch(
+			std::span<RE::Effect* const> effects,
+			float delaySeconds = Maint::Config::kDefaultFXRestoreDelay);
+
+		// Called every player update; restores FX whose deadline passed
 		static void Update(float deltaSeconds);
 
+		// Drops a pending restore without restoring; for effects about to be recycled
+		static void Forget(RE::Effect* effect);
+
 		// Optional: clears all pending restores without restoring (safety / shutdown)
 		static void Clear();
 
 	private:
-		struct RestoreEntry
-		{
-			RE::Effect* effect{ nullptr };
-			float remaining{ 0.0f };  // seconds until kFXPersist is restored
-		};
+		// Seconds on the configured clock: steady_clock, or the sum of player update deltas
+		static double Now();
 
-		// Container holding all pending FX restores
-		static std::vector<RestoreEntry>& Pending();
+		// Pending restores keyed by effect, ordered by absolute deadline on Now()
+		static inline Core::RestoreSchedule<RE::Effect*> pending_;
+		static inline std::vector<RE::Effect*> due_;
+		static inline double gameClock_{ 0.0 };
 	};
 
 	class ExperienceService
@@ -414,8 +815,21 @@ namespace Maint
 	class UpkeepSupervisor
 	{
 	public:
+		// Validates every maintained spell of this actor now and restarts their cadences
 		static void ForceMaintainedSpellUpdate(RE::Actor* const& actor);
+		// Validates only the spells whose cadence deadline passed or that were flagged by events,
+		// across every supervised actor. Actors found without 3D (or dead) are parked: their
+		// checks leave the wheel until OnActorLoaded() brings them back.
+		// In frame-budget mode whatever does not fit this frame carries over to the next.
+		static void ValidateScheduled(float deltaSeconds);
+		// Any thread; fed by the object loaded event sink
+		static void OnActorLoaded(RE::FormID formID);
+		static void Track(RE::Actor* actor, MaintainedRegistry::Handle handle, const RE::SpellItem* base);
+		// Player only; fed by the active effect event sink
+		static void RequestCheck(MaintainedRegistry::Handle handle);
 		static void CheckUpkeepValidity(RE::Actor* const& actor);
+		// Followers whose magicka went negative lose every maintained spell
+		static void CheckNPCUpkeepValidity();
 
 		static void UpdateConjureWatch(RE::Actor* actor);
 		static void UpdateConjureRecasts(RE::Actor* player, float deltaSeconds);
@@ -424,7 +838,66 @@ namespace Maint
 
 		static void ClearCache();
 	private:
-		static inline MaintainedEffectsCache cache_;
+		// One per actor with a registry; slot 0 is the player. Slots live until ClearCache().
+		struct Supervised
+		{
+			RE::ActorHandle handle{};
+			RE::FormID formID{ 0 };
+			MaintainedRegistry* registry{ nullptr };
+			MaintainedEffectsCache cache{};
+		};
+
+		// Engine side of the validation loop; the scheduling itself lives in Core::SupervisorLoop
+		struct LoopTraits
+		{
+			using Handle = MaintainedRegistry::Handle;
+			using Slot = Supervised;
+			using Live = RE::Actor*;  // nullptr when unloaded, dead or gone
+
+			static constexpr float kTickSeconds = ValidationScheduler::kTickSeconds;
+			static constexpr std::size_t kWheelSize = ValidationScheduler::kWheelSize;
+
+#if MAINT_PROFILING
+			struct PassProbe
+			{
+				ScopedProbe probe{ Probe::kValidateScheduled };
+			};
+#else
+			struct PassProbe
+			{};
+#endif
+
+			// Resolves and indexes an actor the first time one of its checks comes up in a pass
+			static RE::Actor* Resolve(std::uint16_t slot, Supervised& state);
+			static bool Validate(Supervised& state, RE::Actor* actor, MaintainedRegistry::Handle handle);
+			static void Sweep(Supervised& state, RE::Actor* actor);
+			static bool Holds(const Supervised& state, MaintainedRegistry::Handle handle);
+			static float CadenceOf(const Supervised& state, MaintainedRegistry::Handle handle);
+			static void Parked(const Supervised& state);
+
+			template <class Fn>
+			static void ForEachEntry(const Supervised& state, Fn&& fn)
+			{
+				for (const auto& [base, _] : state.registry->entries()) {
+					fn(state.registry->find(base), ValidationScheduler::CadenceFor(base));
+				}
+			}
+		};
+
+		static Supervised& Player();
+		static std::uint16_t SlotFor(RE::Actor* actor);
+		static void WakeLoaded();
+
+		static void ApplyDeferredDispels(RE::Actor* actor, MaintainedRegistry& registry);
+		static void ValidateEntry(RE::Actor* actor, RE::SpellItem* base, Domain::MaintainedPair& pair, const MaintainedEffectsCache& spell2ae);
+		static std::size_t SweepInvalid(RE::Actor* actor, MaintainedRegistry& registry);
+
+		static inline Core::SupervisorLoop<LoopTraits> loop_;
+		static inline std::vector<RE::SpellItem*> removals_;
+
+		// Load events for parked actors, handed from the event thread to the next pass
+		static inline std::mutex wakeMtx_;
+		static inline std::vector<RE::FormID> wakes_;
 
 		static inline int evictionWindowTicks_ = 0;
 
@@ -435,9 +908,15 @@ namespace Maint
 	{
 	public:
 		static void MaintainSpell(RE::SpellItem* const& baseSpell, RE::Actor* const& caster);
-		static void PurgeAll();                // clear registry + FLST, delete temp forms
-		static void BuildActiveSpellsCache();  // rebuild toggles + restore debuff magnitudes
-		static void ApplySilencedFXPostLoad();
+		static void PurgeAll();                // clear registry + FLST, return temp forms to the pool
+		static void BuildActiveSpellsCache(bool restoreDebuffMagnitudes = true);  // rebuild toggles (+ debuff magnitudes for v1 co-saves)
+		// Brings every maintained spell's FX to the configured silence state in one batch;
+		// only spells whose state differs are touched. Run post-load and on MCM close.
+		static void ReconcileSilencedFX();
+
+		// Re-prices every maintained spell from its cached inputs and re-applies the debuffs
+		// whose cost changed; run after the cost settings change
+		static void RepriceUpkeep();
 	};
 
 	// ===== Hooks / Integration ===================================================
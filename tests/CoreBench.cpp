@@ -0,0 +1,609 @@
+// Throughput of the Core structures on the plugin's hot paths. Not part of ctest;
+// run core_bench directly and compare numbers across changes on the same machine.
+
+#include "Core.hpp"
+#include "StandIns.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <execution>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+using namespace Maint::Core;
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	// Runs `body` (which performs `ops` operations) until at least 200 ms have elapsed
+	template <class F>
+	void Report(const char* name, std::size_t ops, F&& body)
+	{
+		std::size_t total = 0;
+		const auto start = Clock::now();
+		auto elapsed = Clock::duration::zero();
+		do {
+			body();
+			total += ops;
+			elapsed = Clock::now() - start;
+		} while (elapsed < std::chrono::milliseconds(200));
+
+		const auto seconds = std::chrono::duration<double>(elapsed).count();
+		std::printf("%-44s %14.0f ops/s\n", name, static_cast<double>(total) / seconds);
+	}
+
+	volatile std::size_t sink = 0;
+
+	// MaintainedEffectsCache before the generation counter: rebuilt whenever the effect list
+	// length differed from the number of cached spells, which a buffed actor never matches
+	struct LegacyEffectsCache
+	{
+		std::unordered_map<const StandIn::Spell*, std::vector<StandIn::Effect*>> cache{};
+		std::size_t rebuilds{ 0 };
+
+		void GetFor(const StandIn::Actor& actor)
+		{
+			const auto count = std::ranges::count_if(actor.effects, [](const auto* e) { return e != nullptr; });
+			if (static_cast<std::size_t>(count) == cache.size()) {
+				return;
+			}
+
+			++rebuilds;
+			cache.clear();
+			for (auto* e : actor.effects) {
+				if (const auto [spell, pinned] = StandIn::Effects::Classify(actor.registry, e); spell) {
+					if (pinned) {
+						StandIn::Effects::Pin(e);
+					}
+					cache[spell].push_back(e);
+				}
+			}
+		}
+	};
+
+	// EffectRestorer before the deadline queue: a vector scanned on every push for dedup and
+	// walked on every update to count each entry's remaining delay down
+	struct LinearRestorer
+	{
+		struct Entry
+		{
+			std::uint32_t effect;
+			float remaining;
+		};
+		std::vector<Entry> pending{};
+
+		void Push(std::uint32_t effect, float delay)
+		{
+			for (auto& entry : pending) {
+				if (entry.effect == effect) {
+					entry.remaining = (std::max)(entry.remaining, delay);
+					return;
+				}
+			}
+			pending.push_back({ effect, delay });
+		}
+
+		void Update(float deltaSeconds, std::vector<std::uint32_t>& due)
+		{
+			const float step = (std::min)(deltaSeconds, 0.1f);
+			for (auto it = pending.begin(); it != pending.end();) {
+				it->remaining -= step;
+				if (it->remaining <= 0.0f) {
+					due.push_back(it->effect);
+					it = pending.erase(it);
+				} else {
+					++it;
+				}
+			}
+		}
+	};
+
+	// One heavily buffed player over 1,000 validation ticks (0.5 s each): 32 maintained spells
+	// with three effects apiece among ~350 active effects, a few background effects applied or
+	// expiring every tick and a maintain/dispel (registry change) every hundred ticks.
+	// Returns the number of full rebuilds.
+	template <class Validate>
+	std::size_t PlayBuffedTicks(Validate&& validate)
+	{
+		constexpr std::size_t kMaintained = 32;
+		constexpr std::size_t kBackground = 250;
+
+		std::mt19937_64 script{ 7 };
+		std::deque<StandIn::Spell> spells(kMaintained * 2 + 64);
+		std::deque<StandIn::Effect> storage;
+		StandIn::Registry registry;
+		StandIn::Actor actor{ .formID = StandIn::Effects::WatchedKey(), .registry = &registry };
+		std::uint16_t nextID = 1;
+
+		const auto apply = [&](StandIn::Spell* spell) {
+			auto& e = storage.emplace_back(StandIn::Effect{ nextID++, spell, 0.0f });
+			actor.effects.push_back(&e);
+			StandIn::EffectIndex::OnEffectChanged(actor.formID, e.uniqueID, true);
+		};
+
+		for (std::size_t i = 0; i < kMaintained; ++i) {
+			registry[&spells[i]] = &spells[kMaintained + i];
+			for (int n = 0; n < 3; ++n) {
+				apply(&spells[i]);
+			}
+		}
+		for (std::size_t i = 0; i < kBackground; ++i) {
+			apply(&spells[kMaintained * 2 + script() % 64]);
+		}
+
+		std::size_t rebuilds = 0;
+		for (int tick = 0; tick < 1000; ++tick) {
+			for (auto n = script() % 4; n > 0; --n) {
+				if (script() % 2 == 0) {
+					apply(&spells[kMaintained * 2 + script() % 64]);
+				} else {
+					const auto at = kMaintained * 3 + script() % (actor.effects.size() - kMaintained * 3);
+					StandIn::EffectIndex::OnEffectChanged(actor.formID, actor.effects[at]->uniqueID, false);
+					actor.effects.erase(actor.effects.begin() + static_cast<std::ptrdiff_t>(at));
+				}
+			}
+			if (tick % 100 == 99) {
+				StandIn::EffectIndex::Invalidate();
+			}
+			rebuilds = validate(actor);
+		}
+		return rebuilds;
+	}
+}
+
+int main()
+{
+	std::mt19937_64 rng{ 42 };
+
+	// MaintainedEffectsCache: full walks per 1,000 ticks, list-length polling vs generation+deltas
+	{
+		std::size_t legacyRebuilds = 0;
+		Report("Effect cache, length polling (1000 ticks)", 1000, [&] {
+			LegacyEffectsCache cache;
+			legacyRebuilds = PlayBuffedTicks([&](const StandIn::Actor& actor) {
+				cache.GetFor(actor);
+				sink = sink + cache.cache.size();
+				return cache.rebuilds;
+			});
+		});
+
+		std::size_t indexRebuilds = 0;
+		Report("Effect cache, generation+deltas (1000 ticks)", 1000, [&] {
+			StandIn::EffectIndex index;
+			indexRebuilds = PlayBuffedTicks([&](StandIn::Actor& actor) {
+				const auto& view = index.GetFor(&actor);
+				sink = sink + view.contains(nullptr);
+				return view.rebuilds();
+			});
+			index.Clear();
+		});
+
+		std::printf("%-44s %14zu\n", "  rebuilds/1000 ticks, length polling", legacyRebuilds);
+		std::printf("%-44s %14zu\n", "  rebuilds/1000 ticks, generation+deltas", indexRebuilds);
+	}
+
+	// Supervisor revalidation: 32 maintained spells per actor, 50 actors, 60 fps frames
+	{
+		constexpr std::size_t kEntries = 32 * 50;
+		TimingWheel<std::uint32_t, 64> wheel{ 0.25f };
+		std::vector<std::uint32_t> due;
+		for (std::uint32_t i = 0; i < kEntries; ++i) {
+			wheel.Schedule(i, static_cast<float>(rng() % 1000) / 100.0f);
+		}
+
+		Report("TimingWheel advance+reschedule (1600 entries)", 600, [&] {
+			for (int frame = 0; frame < 600; ++frame) {
+				due.clear();
+				wheel.Advance(1.0f / 60.0f, due);
+				for (const auto id : due) {
+					wheel.Schedule(id, 5.0f);
+				}
+				sink = sink + due.size();
+			}
+		});
+	}
+
+	// EffectRestorer, linear vector vs RestoreSchedule. Closing the MCM re-silences every FX of
+	// every maintained spell in one burst; the second batch re-pushes the same effects (reopen
+	// and close), which is where the linear dedup scan goes quadratic.
+	{
+		constexpr std::uint32_t kBurst = 4000;
+		constexpr float kFrame = 1.0f / 60.0f;
+		std::vector<std::uint32_t> due;
+
+		Report("Restore burst push x2, linear (4000 FX)", 2 * kBurst, [&] {
+			LinearRestorer restorer;
+			for (int batch = 0; batch < 2; ++batch) {
+				for (std::uint32_t i = 0; i < kBurst; ++i) {
+					restorer.Push(i, 2.0f);
+				}
+			}
+			sink = sink + restorer.pending.size();
+		});
+		Report("Restore burst push x2, schedule (4000 FX)", 2 * kBurst, [&] {
+			RestoreSchedule<std::uint32_t> schedule;
+			for (int batch = 0; batch < 2; ++batch) {
+				for (std::uint32_t i = 0; i < kBurst; ++i) {
+					schedule.Arm(i, 2.0);
+				}
+			}
+			sink = sink + schedule.size();
+		});
+
+		// Every frame the burst stays silenced (2 s at 60 fps) pays the per-update cost
+		{
+			LinearRestorer restorer;
+			for (std::uint32_t i = 0; i < kBurst; ++i) {
+				restorer.Push(i, 1.0e9f);
+			}
+			Report("Restore frame, 4000 pending, linear", 1, [&] {
+				due.clear();
+				restorer.Update(kFrame, due);
+				sink = sink + due.size();
+			});
+		}
+		{
+			RestoreSchedule<std::uint32_t> schedule;
+			for (std::uint32_t i = 0; i < kBurst; ++i) {
+				schedule.Arm(i, 1.0e9);
+			}
+			double now = 0.0;
+			Report("Restore frame, 4000 pending, schedule", 1, [&] {
+				now += kFrame;
+				schedule.AdvanceFrame();
+				due.clear();
+				schedule.PopDue(now, 2, due);
+				sink = sink + due.size();
+			});
+		}
+	}
+
+	// DeadlineQueue alone: thousands of pending restores with repeated dedup pushes
+	{
+		constexpr std::size_t kKeys = 4000;
+		DeadlineQueue<std::uint32_t> queue;
+		std::vector<std::uint32_t> due;
+		double now = 0.0;
+
+		Report("DeadlineQueue schedule+pop (4000 keys)", kKeys, [&] {
+			for (std::uint32_t i = 0; i < kKeys; ++i) {
+				queue.ScheduleNoEarlier(static_cast<std::uint32_t>(rng() % kKeys), now + static_cast<double>(rng() % 100) / 10.0);
+			}
+			now += 1.0;
+			due.clear();
+			queue.PopDue(now, due);
+			sink = sink + due.size();
+		});
+	}
+
+	// Allocator churn: a range held near full while maintained spells come and go, and the
+	// periodic reconcile over it
+	for (const std::size_t capacity : { std::size_t{ 64 }, std::size_t{ 1024 }, std::size_t{ 4096 } }) {
+		IdRangeAllocator ids{ 0xFF03F000, 1, capacity };
+		std::vector<std::uint32_t> held;
+		while (held.size() < capacity * 7 / 8) {
+			held.push_back(*ids.Allocate());
+		}
+
+		char name[64];
+		std::snprintf(name, sizeof(name), "IdRangeAllocator free+allocate (%zu IDs)", capacity);
+		Report(name, 1000, [&] {
+			for (int i = 0; i < 1000; ++i) {
+				auto& slot = held[static_cast<std::size_t>(rng() % held.size())];
+				ids.Free(slot);
+				slot = *ids.Allocate();
+			}
+			sink = sink + ids.count();
+		});
+
+		std::snprintf(name, sizeof(name), "IdRangeAllocator reconcile (%zu IDs)", capacity);
+		Report(name, 1, [&] {
+			const auto freed = ids.Reconcile(
+				[&](const auto& mark) {
+					for (const auto id : held) {
+						mark(id);
+					}
+				},
+				[](std::uint32_t) {});
+			sink = sink + freed;
+		});
+	}
+
+	// Registry sweeps: 50 registries of 32 entries laid out like MaintainedPair, walked the
+	// way the recast and validation passes walk them, in dense columns and in the
+	// unordered_map the registry used before
+	{
+		struct Pair
+		{
+			void* infinite;
+			void* debuff;
+			float recastRemaining;
+			bool recastQueued;
+			bool isConjureMinion;
+			bool fxSilenced;
+			bool markedForRemoval;
+		};
+
+		constexpr std::size_t kRegistries = 50;
+		constexpr std::size_t kEntries = 32;
+		std::vector<std::unique_ptr<int>> bases;  // distinct heap addresses for keys
+		std::vector<DenseTable<void*, Pair>> dense(kRegistries);
+		std::vector<std::unordered_map<void*, Pair>> maps(kRegistries);
+		for (std::size_t r = 0; r < kRegistries; ++r) {
+			for (std::size_t e = 0; e < kEntries; ++e) {
+				void* base = bases.emplace_back(std::make_unique<int>()).get();
+				const Pair pair{ base, base, 1.0f, rng() % 4 == 0, rng() % 3 == 0, false, false };
+				dense[r].Insert(base, pair);
+				maps[r].emplace(base, pair);
+			}
+		}
+
+		const auto step = [](Pair& pair) {
+			if (pair.isConjureMinion && pair.recastQueued) {
+				pair.recastRemaining -= 0.5f;
+				pair.recastQueued = pair.recastRemaining > -1e6f;
+			}
+			return pair.markedForRemoval ? 0u : 1u;
+		};
+
+		Report("Registry sweep: DenseTable (1600 entries)", kRegistries * kEntries, [&] {
+			std::size_t live = 0;
+			for (auto& table : dense) {
+				for (auto& pair : table.column<0>()) {
+					live += step(pair);
+				}
+			}
+			sink = sink + live;
+		});
+		Report("Registry sweep: unordered_map (1600 entries)", kRegistries * kEntries, [&] {
+			std::size_t live = 0;
+			for (auto& map : maps) {
+				for (auto& [_, pair] : map) {
+					live += step(pair);
+				}
+			}
+			sink = sink + live;
+		});
+
+		std::vector<std::pair<std::size_t, void*>> probes(4096);
+		for (auto& [r, key] : probes) {
+			r = static_cast<std::size_t>(rng() % kRegistries);
+			key = dense[r].keys()[rng() % kEntries];
+		}
+		Report("Registry find by base: DenseTable", probes.size(), [&] {
+			std::size_t found = 0;
+			for (const auto& [r, key] : probes) {
+				found += dense[r].IndexOf(key) >= 0;
+			}
+			sink = sink + found;
+		});
+		Report("Registry find by base: unordered_map", probes.size(), [&] {
+			std::size_t found = 0;
+			for (const auto& [r, key] : probes) {
+				found += maps[r].contains(key);
+			}
+			sink = sink + found;
+		});
+	}
+
+	// Registry lookups through generation-checked handles
+	{
+		SlotTable table;
+		std::vector<SlotHandle> handles;
+		for (int i = 0; i < 32; ++i) {
+			handles.push_back(table.Acquire());
+		}
+		for (int i = 0; i < 8; ++i) {
+			table.SwapRemove(static_cast<std::size_t>(i) * 3);
+		}
+
+		Report("SlotTable resolve (32 handles)", 32 * 1000, [&] {
+			std::size_t live = 0;
+			for (int round = 0; round < 1000; ++round) {
+				for (const auto h : handles) {
+					live += table.Resolve(h) >= 0;
+				}
+			}
+			sink = sink + live;
+		});
+	}
+
+	// Preclassify: a load order's worth of spells through a stand-in for the static rule
+	// chain (flag tests, keyword scans, editor ID compare), then the per-cast cost of
+	// turning down a spell the chain already rejected
+	{
+		struct Spell
+		{
+			std::uint32_t id;
+			bool fireAndForget;
+			bool scroll;
+			float duration;
+			std::vector<std::uint32_t> keywords;
+			std::string editorID;
+		};
+
+		constexpr std::size_t kSpells = 12000;
+		std::vector<Spell> spells(kSpells);
+		std::vector<std::uint32_t> ids(kSpells);
+		for (std::size_t i = 0; i < kSpells; ++i) {
+			auto& s = spells[i];
+			s.id = static_cast<std::uint32_t>(i) * 7 + 0x800;
+			s.fireAndForget = rng() % 4 != 0;
+			s.scroll = rng() % 20 == 0;
+			s.duration = static_cast<float>(rng() % 120);
+			s.keywords.resize(rng() % 6);
+			for (auto& k : s.keywords) {
+				k = static_cast<std::uint32_t>(rng() % 64);
+			}
+			s.editorID = "Spell" + std::to_string(rng());
+			ids[i] = s.id;
+		}
+
+		const auto rejects = [](const Spell& s) {
+			const auto hasKeyword = [&](std::uint32_t k) { return std::ranges::find(s.keywords, k) != s.keywords.end(); };
+			return !s.fireAndForget || s.scroll || s.duration <= 5.0f ||
+			       hasKeyword(1) || hasKeyword(2) || s.editorID == "_m3HealerDummySpell";
+		};
+
+		DenseIdFlags flags;
+		flags.Assign(ids);
+		Report("Preclassify (12000 spells, seq)", kSpells, [&] {
+			flags.Classify(std::execution::seq, [&](std::size_t i) { return !rejects(spells[i]); });
+			sink = sink + flags.count();
+		});
+
+		// Ineligible casts: the verdict used to be followed by the rule chain anyway
+		std::vector<std::size_t> casts;
+		while (casts.size() < 4096) {
+			if (const auto c = static_cast<std::size_t>(rng() % kSpells); rejects(spells[c])) {
+				casts.push_back(c);
+			}
+		}
+		Report("Ineligible cast: verdict + rule chain", casts.size(), [&] {
+			std::size_t rejected = 0;
+			for (const auto c : casts) {
+				rejected += !flags.Lookup(spells[c].id).value_or(false) && rejects(spells[c]);
+			}
+			sink = sink + rejected;
+		});
+		Report("Ineligible cast: verdict only", casts.size(), [&] {
+			std::size_t rejected = 0;
+			for (const auto c : casts) {
+				rejected += !flags.Lookup(spells[c].id).value_or(false);
+			}
+			sink = sink + rejected;
+		});
+	}
+
+	// Upkeep re-pricing after an MCM change: 32 maintained spells on each of 50 casters,
+	// priced as one batch per caster against one call per spell
+	{
+		constexpr std::size_t kSpells = 32 * 50;
+		std::vector<float> baseCosts(kSpells);
+		std::vector<float> durations(kSpells);
+		std::vector<float> costs(kSpells);
+		for (std::size_t i = 0; i < kSpells; ++i) {
+			baseCosts[i] = static_cast<float>(rng() % 300);
+			durations[i] = static_cast<float>(rng() % 240);
+		}
+
+		Report("Upkeep pricing: per spell (1600 spells)", kSpells, [&] {
+			for (std::size_t i = 0; i < kSpells; ++i) {
+				UpkeepPricing::PriceBatch({ &baseCosts[i], 1 }, { &durations[i], 1 }, 60.0f, 0.65f, 0.9f, { &costs[i], 1 });
+			}
+			sink = sink + static_cast<std::size_t>(costs[kSpells - 1]);
+		});
+		Report("Upkeep pricing: batch of 32 (1600 spells)", kSpells, [&] {
+			for (std::size_t i = 0; i < kSpells; i += 32) {
+				UpkeepPricing::PriceBatch(
+					std::span{ baseCosts }.subspan(i, 32),
+					std::span{ durations }.subspan(i, 32),
+					60.0f,
+					0.65f,
+					0.9f,
+					std::span{ costs }.subspan(i, 32));
+			}
+			sink = sink + static_cast<std::size_t>(costs[kSpells - 1]);
+		});
+	}
+
+	// Co-save lookup: a synthetic 50 MB co-save of 400 plugin blocks with ours last, found
+	// through the directory against the cookie scan the loader falls back to (lookups/s)
+	{
+		constexpr std::uint32_t kOurs = 0x474D544D;  // 'MTMG'
+		const std::string_view cookie = "MAINTAINEDMAGICNEWGENCOOKIESAVE";
+		std::vector<std::byte> cosave;
+		const auto put = [&](const auto& value) {
+			const auto* raw = reinterpret_cast<const std::byte*>(&value);
+			cosave.insert(cosave.end(), raw, raw + sizeof(value));
+		};
+
+		constexpr std::uint32_t kPlugins = 400;
+		constexpr std::uint32_t kChunks = 4;
+		constexpr std::uint32_t kChunkBytes = (50u << 20) / (kPlugins * kChunks);
+		put(CosaveDirectory::FileHeader{ { 'S', 'K', 'S', 'E' }, 2, 0, 0, kPlugins + 1 });
+		for (std::uint32_t p = 0; p < kPlugins; ++p) {
+			put(CosaveDirectory::PluginHeader{ 0x1000 + p, kChunks, kChunks * (kChunkBytes + 12) });
+			for (std::uint32_t c = 0; c < kChunks; ++c) {
+				put(CosaveDirectory::ChunkHeader{ c, 1, kChunkBytes });
+				for (std::uint32_t i = 0; i < kChunkBytes; ++i) {
+					cosave.push_back(static_cast<std::byte>(rng()));
+				}
+			}
+		}
+		put(CosaveDirectory::PluginHeader{ kOurs, 1, static_cast<std::uint32_t>(12 + 4096) });
+		put(CosaveDirectory::ChunkHeader{ kOurs, 2, 4096 });
+		const auto record = cosave.size();
+		cosave.resize(record + 4096);
+		std::memcpy(cosave.data() + record, cookie.data(), cookie.size());
+
+		const auto accept = [&](std::span<const std::byte> chunk) {
+			return chunk.size() >= cookie.size() && std::memcmp(chunk.data(), cookie.data(), cookie.size()) == 0;
+		};
+		Report("Co-save lookup: directory walk (50 MB)", 1, [&] {
+			const auto found = CosaveDirectory::FindChunk(cosave, kOurs, kOurs, accept);
+			sink = sink + static_cast<std::size_t>(found.chunk.data() - cosave.data());
+		});
+
+		const auto search = PatternSearch::Select();
+		Report("Co-save lookup: cookie scan, best kernel", 1, [&] {
+			sink = sink + search(cosave, 0, cosave.size() - cookie.size() + 1, cookie);
+		});
+	}
+
+	// Co-save fallback scan: 50 MB with the cookie at the very end
+	{
+		const std::string_view cookie = "MTMG_MaintainedMagic_CosaveV2!!";
+		std::vector<std::byte> buffer(50u << 20);
+		for (auto& b : buffer) {
+			b = static_cast<std::byte>(rng());
+		}
+		std::memcpy(buffer.data() + buffer.size() - cookie.size(), cookie.data(), cookie.size());
+		const auto limit = buffer.size() - cookie.size() + 1;
+
+		const auto bench = [&](const char* name, PatternSearch::SearchFn fn) {
+			Report(name, buffer.size(), [&] { sink = sink + fn(buffer, 0, limit, cookie); });
+		};
+
+		bench("Pattern search scalar (bytes, 50 MB)", &PatternSearch::Scalar);
+#if defined(MAINT_CORE_X64)
+		bench("Pattern search SSE2 (bytes, 50 MB)", &PatternSearch::SSE2);
+		if (PatternSearch::CPUHasAVX2()) {
+			bench("Pattern search AVX2 (bytes, 50 MB)", &PatternSearch::AVX2);
+		}
+#endif
+
+		// Adversarial: back-to-back copies of the cookie with one middle byte broken, so
+		// every copy passes the first/last byte filter and reaches the memcmp. Every
+		// dispatch level must still land on the one real cookie at the end.
+		for (std::size_t at = 0; at + cookie.size() <= buffer.size() - cookie.size(); at += cookie.size()) {
+			std::memcpy(buffer.data() + at, cookie.data(), cookie.size());
+			buffer[at + 1 + (at / cookie.size()) % (cookie.size() - 2)] = std::byte{ '?' };
+		}
+		std::memcpy(buffer.data() + buffer.size() - cookie.size(), cookie.data(), cookie.size());
+
+		std::vector<std::pair<const char*, PatternSearch::SearchFn>> kernels{
+			{ "Near-miss search scalar (bytes, 50 MB)", &PatternSearch::Scalar }
+		};
+#if defined(MAINT_CORE_X64)
+		kernels.emplace_back("Near-miss search SSE2 (bytes, 50 MB)", &PatternSearch::SSE2);
+		if (PatternSearch::CPUHasAVX2()) {
+			kernels.emplace_back("Near-miss search AVX2 (bytes, 50 MB)", &PatternSearch::AVX2);
+		}
+#endif
+		const auto expect = buffer.size() - cookie.size();
+		for (const auto& [name, fn] : kernels) {
+			if (const auto got = fn(buffer, 0, limit, cookie); got != expect) {
+				std::printf("%s: found offset %zu, expected %zu\n", name, got, expect);
+				return 1;
+			}
+			bench(name, fn);
+		}
+	}
+
+	return 0;
+}
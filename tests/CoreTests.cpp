@@ -0,0 +1,1105 @@
+// Host-side checks for src/Core.hpp. Each container is driven against a plain
+// standard-library model; any mismatch is reported and fails the run.
+
+#include "Core.hpp"
+#include "StandIns.hpp"
+
+#include <cstddef>
+#include <cstdio>
+#include <deque>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <unordered_set>
+
+using namespace Maint::Core;
+
+namespace
+{
+	int failures = 0;
+
+#define CHECK(cond)                                                              \
+	do {                                                                         \
+		if (!(cond)) {                                                           \
+			++failures;                                                          \
+			std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+		}                                                                        \
+	} while (false)
+
+	std::mt19937_64 rng{ 0x4D544D47 };
+
+	std::size_t Roll(std::size_t n) { return static_cast<std::size_t>(rng() % n); }
+
+	// ===== Slot table ========================================================
+
+	void TestSlotTable()
+	{
+		SlotTable table;
+		std::vector<int> column;  // owner's dense column mirrored against the table
+		std::map<int, SlotHandle> live;
+		std::vector<SlotHandle> dead;
+		int nextValue = 0;
+
+		for (int step = 0; step < 20000; ++step) {
+			const auto op = Roll(10);
+			if (op < 5 || column.empty()) {
+				const auto h = table.Acquire();
+				CHECK(static_cast<bool>(h));
+				CHECK(table.Resolve(h) == static_cast<std::ptrdiff_t>(column.size()));
+				column.push_back(nextValue);
+				live[nextValue++] = h;
+			} else if (op < 9) {
+				const auto dense = Roll(column.size());
+				const auto h = table.HandleAt(dense);
+				CHECK(live.at(column[dense]) == h);
+
+				live.erase(column[dense]);
+				dead.push_back(h);
+				table.SwapRemove(dense);
+				column[dense] = column.back();
+				column.pop_back();
+			} else if (Roll(50) == 0) {
+				for (const auto& [value, h] : live) {
+					dead.push_back(h);
+				}
+				live.clear();
+				column.clear();
+				table.Clear();
+			}
+
+			CHECK(table.size() == column.size());
+		}
+
+		for (const auto& [value, h] : live) {
+			const auto dense = table.Resolve(h);
+			CHECK(dense >= 0 && column[static_cast<std::size_t>(dense)] == value);
+		}
+
+		// A released handle stays stale even after its slot is reused. Generations are
+		// 16-bit, so only recent releases are guaranteed not to have wrapped.
+		for (std::size_t i = dead.size() > 1000 ? dead.size() - 1000 : 0; i < dead.size(); ++i) {
+			const auto dense = table.Resolve(dead[i]);
+			CHECK(dense < 0);
+		}
+
+		CHECK(table.Resolve(SlotHandle{}) < 0);
+	}
+
+	void TestDenseTable()
+	{
+		DenseTable<int, std::string, float> table;
+		std::map<int, std::pair<std::string, float>> model;
+		std::map<int, SlotHandle> handles;
+
+		for (int step = 0; step < 20000; ++step) {
+			const int key = static_cast<int>(Roll(48));
+			const auto op = Roll(10);
+			if (op < 5) {
+				const auto value = std::to_string(step);
+				const auto h = table.Insert(key, value, static_cast<float>(step));
+				if (const auto it = handles.find(key); it != handles.end()) {
+					CHECK(h == it->second);  // overwriting keeps the handle
+				}
+				handles[key] = h;
+				model[key] = { value, static_cast<float>(step) };
+			} else if (op < 9) {
+				const auto index = table.IndexOf(key);
+				CHECK((index >= 0) == model.contains(key));
+				if (index >= 0) {
+					table.EraseAt(static_cast<std::size_t>(index));
+					model.erase(key);
+					CHECK(table.Resolve(handles.at(key)) < 0);
+					handles.erase(key);
+				}
+			} else if (Roll(40) == 0) {
+				table.Clear();
+				model.clear();
+				handles.clear();
+			}
+
+			CHECK(table.size() == model.size());
+			CHECK(table.empty() == model.empty());
+		}
+
+		for (const auto& [key, value] : model) {
+			const auto index = table.Resolve(handles.at(key));
+			CHECK(index >= 0 && index == table.IndexOf(key));
+			CHECK(table.Find(key) == handles.at(key));
+			CHECK(table.keys()[static_cast<std::size_t>(index)] == key);
+			CHECK(table.column<0>()[static_cast<std::size_t>(index)] == value.first);
+			CHECK(table.column<1>()[static_cast<std::size_t>(index)] == value.second);
+		}
+		CHECK(!table.Find(1000));
+		CHECK(table.column<0>().size() == model.size());
+	}
+
+	// ===== Two-level bitmap ==================================================
+
+	void CheckBitmapMatches(const TwoLevelBitmap& bitmap, const std::set<std::size_t>& model)
+	{
+		CHECK(bitmap.count() == model.size());
+		CHECK(bitmap.full() == (model.size() == bitmap.capacity()));
+		for (std::size_t i = 0; i < bitmap.capacity() + 2; ++i) {
+			CHECK(bitmap.Test(i) == model.contains(i));
+		}
+	}
+
+	void TestTwoLevelBitmapCapacity(std::size_t capacity)
+	{
+		TwoLevelBitmap bitmap;
+		bitmap.Resize(capacity);
+		CHECK(bitmap.capacity() == capacity);
+
+		std::set<std::size_t> model;
+		for (std::size_t step = 0; step < capacity * 8 + 64; ++step) {
+			switch (Roll(4)) {
+			case 0:
+			case 1:
+				{
+					// First-clear always hands out the lowest free index
+					const auto got = bitmap.SetFirstClear();
+					std::optional<std::size_t> expect;
+					for (std::size_t i = 0; i < capacity; ++i) {
+						if (!model.contains(i)) {
+							expect = i;
+							break;
+						}
+					}
+					CHECK(got == expect);
+					if (got) {
+						model.insert(*got);
+					}
+					break;
+				}
+			case 2:
+				{
+					const auto index = Roll(capacity + 2);
+					CHECK(bitmap.Set(index) == (index < capacity && model.insert(index).second));
+					break;
+				}
+			default:
+				{
+					const auto index = Roll(capacity + 2);
+					CHECK(bitmap.Reset(index) == (model.erase(index) == 1));
+					break;
+				}
+			}
+		}
+		CheckBitmapMatches(bitmap, model);
+
+		// Fill to capacity: nothing past the range is ever handed out
+		while (const auto got = bitmap.SetFirstClear()) {
+			CHECK(*got < capacity);
+			model.insert(*got);
+		}
+		CHECK(model.size() == capacity);
+		CheckBitmapMatches(bitmap, model);
+
+		bitmap.Clear();
+		model.clear();
+		CheckBitmapMatches(bitmap, model);
+	}
+
+	void TestTwoLevelBitmap()
+	{
+		for (std::size_t capacity = 1; capacity <= 200; ++capacity) {
+			TestTwoLevelBitmapCapacity(capacity);
+		}
+		TestTwoLevelBitmapCapacity(TwoLevelBitmap::kMaxCapacity);
+
+		TwoLevelBitmap clamped;
+		clamped.Resize(TwoLevelBitmap::kMaxCapacity + 100);
+		CHECK(clamped.capacity() == TwoLevelBitmap::kMaxCapacity);
+	}
+
+	// ===== ID range allocator ================================================
+
+	void TestIdRangeAllocator()
+	{
+		constexpr std::uint32_t kBase = 0xFF03F000;
+		IdRangeAllocator ids{ kBase, 1, 200 };
+		std::set<std::uint32_t> model;
+
+		CHECK(ids.IdAt(0) == kBase + 1);
+		CHECK(!ids.InRange(kBase) && ids.InRange(kBase + 1) && ids.InRange(kBase + 200) && !ids.InRange(kBase + 201));
+		CHECK(!ids.InRange(0) && !ids.InRange(kBase - 1));
+
+		for (int step = 0; step < 20000; ++step) {
+			const auto id = kBase + static_cast<std::uint32_t>(Roll(204));
+			switch (Roll(4)) {
+			case 0:
+				if (const auto got = ids.Allocate()) {
+					CHECK(!model.contains(*got) && ids.InRange(*got));
+					model.insert(*got);
+				} else {
+					CHECK(model.size() == 200);
+				}
+				break;
+			case 1:
+				CHECK(ids.AllocateSpecific(id) == (ids.InRange(id) && !model.contains(id)));
+				if (ids.InRange(id)) {
+					model.insert(id);
+				}
+				break;
+			default:
+				CHECK(ids.Free(id) == (model.erase(id) != 0));
+				break;
+			}
+			CHECK(ids.count() == model.size());
+			CHECK(ids.free() == 200 - model.size());
+			CHECK(ids.IsAllocated(id) == model.contains(id));
+		}
+
+		// The lowest free ID is handed out first
+		const auto lowest = [&] {
+			for (std::uint32_t id = kBase + 1;; ++id) {
+				if (!model.contains(id)) {
+					return id;
+				}
+			}
+		};
+		if (model.size() < 200) {
+			const auto expect = lowest();
+			CHECK(ids.Allocate() == std::optional<std::uint32_t>{ expect });
+			model.insert(expect);
+		}
+
+		// Reconcile keeps the marked IDs (and ignores marks outside the range)
+		std::set<std::uint32_t> keep;
+		for (const auto id : model) {
+			if (Roll(2) == 0) {
+				keep.insert(id);
+			}
+		}
+		std::set<std::uint32_t> freed;
+		const auto n = ids.Reconcile(
+			[&](const auto& mark) {
+				mark(kBase);
+				mark(0xFFFFFFFF);
+				for (const auto id : keep) {
+					mark(id);
+				}
+			},
+			[&](std::uint32_t id) { freed.insert(id); });
+		CHECK(n == model.size() - keep.size());
+		CHECK(freed.size() == n);
+		for (const auto id : model) {
+			CHECK(ids.IsAllocated(id) == keep.contains(id));
+			CHECK(freed.contains(id) != keep.contains(id));
+		}
+
+		// The range only changes while empty
+		CHECK(keep.empty() || !ids.Resize(10));
+		ids.Clear();
+		CHECK(ids.count() == 0);
+		CHECK(ids.Resize(10) && ids.capacity() == 10 && !ids.InRange(kBase + 11));
+	}
+
+	// ===== Dense ID flags ====================================================
+
+	void TestDenseIdFlags()
+	{
+		std::vector<std::uint32_t> ids;
+		for (int i = 0; i < 1000; ++i) {
+			ids.push_back(static_cast<std::uint32_t>(rng() % 5000));
+		}
+
+		DenseIdFlags flags;
+		flags.Assign(ids);
+
+		const std::set<std::uint32_t> unique(ids.begin(), ids.end());
+		CHECK(flags.size() == unique.size());
+		CHECK(flags.wordCount() == (unique.size() + 63) / 64);
+
+		// Flag = low bit of the ID, written a word at a time
+		std::set<std::uint32_t> flagged;
+		for (std::size_t w = 0; w < flags.wordCount(); ++w) {
+			std::uint64_t bits = ~0ull;  // bits past size() must be masked off
+			for (std::size_t b = 0; b < 64 && w * 64 + b < flags.size(); ++b) {
+				const auto id = flags.IdAt(w * 64 + b);
+				if ((id & 1) == 0) {
+					bits &= ~(1ull << b);
+				} else {
+					flagged.insert(id);
+				}
+			}
+			flags.StoreWord(w, bits);
+		}
+		CHECK(flags.count() == flagged.size());
+
+		for (std::uint32_t id = 0; id < 5001; ++id) {
+			const auto got = flags.Lookup(id);
+			if (!unique.contains(id)) {
+				CHECK(!got.has_value());
+			} else {
+				CHECK(got == std::optional<bool>{ flagged.contains(id) });
+			}
+		}
+
+		// Classify rewrites every word from a per-index predicate
+		flags.Classify(std::execution::seq, [&](std::size_t i) { return flags.IdAt(i) % 3 == 0; });
+		std::size_t thirds = 0;
+		for (const auto id : unique) {
+			thirds += id % 3 == 0;
+			CHECK(flags.Lookup(id) == std::optional<bool>{ id % 3 == 0 });
+		}
+		CHECK(flags.count() == thirds);
+	}
+
+	// ===== Inline ID set =====================================================
+
+	void TestInlineIdSet()
+	{
+		InlineIdSet<int, std::uint32_t, 4> set;
+		std::map<std::uint32_t, int> model;
+
+		for (int step = 0; step < 5000; ++step) {
+			if (Roll(3) != 0 || model.empty()) {
+				const auto id = static_cast<std::uint32_t>(rng() % 1000);
+				if (!model.contains(id)) {
+					set.push(static_cast<int>(id) * 7, id);
+					model[id] = static_cast<int>(id) * 7;
+				}
+			} else {
+				const auto id = std::next(model.begin(), static_cast<std::ptrdiff_t>(Roll(model.size())))->first;
+				CHECK(set.contains(id));
+				CHECK(set.erase(id));
+				model.erase(id);
+				CHECK(!set.contains(id));
+				CHECK(!set.erase(id));
+			}
+
+			if (Roll(200) == 0) {
+				set.clear();
+				model.clear();
+			}
+
+			CHECK(set.size() == model.size());
+		}
+
+		std::multiset<int> values(set.begin(), set.end());
+		std::multiset<int> expected;
+		for (const auto& [id, value] : model) {
+			expected.insert(value);
+		}
+		CHECK(values == expected);
+	}
+
+	// ===== Effect index ======================================================
+
+	// The index after deltas must match a fresh classification of the effect list, and only
+	// an Invalidate() or a queue overflow may cost a full walk
+	void TestEffectIndex()
+	{
+		std::deque<StandIn::Spell> spells(24);
+		std::deque<StandIn::Effect> storage;
+		StandIn::Registry registry;
+		for (std::size_t i = 0; i < 8; ++i) {
+			registry[&spells[i]] = &spells[8 + i];
+		}
+		for (std::size_t i = 16; i < 20; ++i) {
+			spells[i].maintainedKeyword = true;
+		}
+
+		StandIn::Actor actor{ .formID = StandIn::Effects::WatchedKey(), .registry = &registry };
+		StandIn::EffectIndex index;
+		std::uint16_t nextID = 1;
+
+		const auto apply = [&](bool report) {
+			auto& e = storage.emplace_back(StandIn::Effect{ nextID++, &spells[Roll(spells.size())], 5.0f });
+			actor.effects.push_back(&e);
+			if (report) {
+				StandIn::EffectIndex::OnEffectChanged(actor.formID, e.uniqueID, true);
+			}
+		};
+		for (int i = 0; i < 40; ++i) {
+			apply(false);  // present before anyone listened
+		}
+
+		index.GetFor(&actor);
+		std::size_t expectedRebuilds = 1;
+		std::map<std::uint16_t, const StandIn::Spell*> indexed;  // as of the last GetFor
+		std::vector<StandIn::Spell*> removals;
+
+		for (int step = 0; step < 4000; ++step) {
+			bool resync = false;
+			std::set<const StandIn::Spell*> lost;
+
+			for (auto n = Roll(6) + 1; n > 0; --n) {
+				if (Roll(2) == 0 || actor.effects.empty()) {
+					apply(true);
+				} else {
+					const auto at = Roll(actor.effects.size());
+					const auto* e = actor.effects[at];
+					actor.effects.erase(actor.effects.begin() + static_cast<std::ptrdiff_t>(at));
+					StandIn::EffectIndex::OnEffectChanged(actor.formID, e->uniqueID, false);
+					if (const auto it = indexed.find(e->uniqueID); it != indexed.end()) {
+						lost.insert(it->second);
+					}
+				}
+			}
+
+			// Deltas for an actor without an index are dropped
+			StandIn::EffectIndex::OnEffectChanged(0xFF000800, nextID, true);
+
+			if (Roll(100) == 0) {
+				auto* base = &spells[Roll(8)];
+				if (registry.contains(base)) {
+					registry.erase(base);
+				} else {
+					registry[base] = &spells[8 + Roll(8)];
+				}
+				StandIn::EffectIndex::Invalidate();
+				resync = true;
+			}
+			if (Roll(400) == 0) {
+				for (std::size_t i = 0; i <= StandIn::EffectIndex::kMaxPendingDeltas; ++i) {
+					StandIn::EffectIndex::OnEffectChanged(actor.formID, nextID, i % 2 == 0);
+				}
+				++nextID;
+				resync = true;
+			}
+
+			CHECK(StandIn::EffectIndex::HasPendingDeltas());
+			for (auto* e : actor.effects) {
+				e->elapsedSeconds = 5.0f;
+			}
+
+			const auto& view = index.GetFor(&actor);
+			CHECK(!StandIn::EffectIndex::HasPendingDeltas());
+			expectedRebuilds += resync ? 1 : 0;
+			CHECK(view.rebuilds() == expectedRebuilds);
+
+			std::map<const StandIn::Spell*, std::set<std::uint16_t>> expected;
+			indexed.clear();
+			for (auto* e : actor.effects) {
+				const auto [spell, pinned] = StandIn::Effects::Classify(&registry, e);
+				if (spell) {
+					expected[spell].insert(e->uniqueID);
+					indexed[e->uniqueID] = spell;
+				}
+				CHECK((e->elapsedSeconds == 0.0f) == (spell && pinned));
+			}
+			for (const auto& spell : spells) {
+				const auto* set = view.find(&spell);
+				const auto it = expected.find(&spell);
+				CHECK((set != nullptr) == (it != expected.end()));
+				if (set && it != expected.end()) {
+					std::set<std::uint16_t> ids;
+					for (const auto* e : *set) {
+						ids.insert(e->uniqueID);
+					}
+					CHECK(ids == it->second);
+				}
+			}
+
+			index.TakeRemovals(removals);
+			if (!resync) {
+				CHECK(std::set<const StandIn::Spell*>(removals.begin(), removals.end()) == lost);
+			}
+		}
+
+		index.Clear();
+		CHECK(!index.contains(&spells[8]));
+		StandIn::EffectIndex::OnEffectChanged(actor.formID, nextID, true);
+		CHECK(!StandIn::EffectIndex::HasPendingDeltas());
+	}
+
+	// ===== Timing wheel ======================================================
+
+	void TestTimingWheel()
+	{
+		TimingWheel<int, 16> wheel{ 0.5f };
+		std::vector<int> due;
+
+		wheel.Schedule(1, 0.5f);   // 1 tick
+		wheel.Schedule(2, 1.2f);   // rounds up to 3 ticks
+		wheel.Schedule(3, 100.f);  // clamps to the horizon
+		CHECK(wheel.pending() == 3);
+
+		wheel.Advance(0.4f, due);
+		CHECK(due.empty());
+		wheel.Advance(0.1f, due);
+		CHECK(due == std::vector<int>{ 1 });
+
+		due.clear();
+		wheel.Advance(0.5f, due);
+		CHECK(due.empty());
+		wheel.Advance(0.5f, due);
+		CHECK(due == std::vector<int>{ 2 });
+
+		// A hitch longer than the horizon sweeps the wheel once and fires everything
+		due.clear();
+		wheel.Advance(1000.f, due);
+		CHECK(due == std::vector<int>{ 3 });
+		CHECK(wheel.pending() == 0);
+
+		// Idle time does not accumulate while nothing is scheduled
+		due.clear();
+		wheel.Advance(10.f, due);
+		wheel.Schedule(4, 0.5f);
+		wheel.Advance(0.25f, due);
+		CHECK(due.empty());
+
+		// Erased items never fire
+		wheel.Schedule(5, 0.5f);
+		wheel.Schedule(6, 1.0f);
+		CHECK(wheel.EraseIf([](int v) { return v == 5 || v == 4; }) == 2);
+		CHECK(wheel.pending() == 1);
+		due.clear();
+		wheel.Advance(10.f, due);
+		CHECK(due == std::vector<int>{ 6 });
+
+		wheel.Schedule(7, 0.5f);
+		wheel.Clear();
+		CHECK(wheel.pending() == 0);
+		wheel.Advance(10.f, due);
+		CHECK(due == std::vector<int>{ 6 });
+	}
+
+	// ===== Supervisor loop ===================================================
+
+	struct FakeActor
+	{
+		std::vector<std::pair<SlotHandle, float>> entries{};  // handle, cadence
+		bool loaded{ true };
+		std::vector<std::uint16_t> validated{};  // handle slots, in validation order
+		int sweeps{ 0 };
+	};
+
+	struct FakeLoopTraits
+	{
+		using Handle = SlotHandle;
+		using Slot = FakeActor;
+		using Live = FakeActor*;
+
+		static constexpr float kTickSeconds = 0.05f;
+		static constexpr std::size_t kWheelSize = 64;
+
+		struct PassProbe
+		{};
+
+		static FakeActor* Resolve(std::uint16_t, FakeActor& actor) { return actor.loaded ? &actor : nullptr; }
+		static bool Validate(FakeActor& actor, FakeActor*, SlotHandle handle)
+		{
+			if (!Holds(actor, handle)) {
+				return false;
+			}
+			actor.validated.push_back(handle.slot);
+			return true;
+		}
+		static void Sweep(FakeActor& actor, FakeActor*) { ++actor.sweeps; }
+		static bool Holds(const FakeActor& actor, SlotHandle handle)
+		{
+			return std::ranges::any_of(actor.entries, [&](const auto& entry) { return entry.first == handle; });
+		}
+		static float CadenceOf(const FakeActor& actor, SlotHandle handle)
+		{
+			return std::ranges::find(actor.entries, handle, &std::pair<SlotHandle, float>::first)->second;
+		}
+		static inline int parks = 0;
+		static void Parked(const FakeActor&) { ++parks; }
+
+		template <class Fn>
+		static void ForEachEntry(const FakeActor& actor, Fn&& fn)
+		{
+			for (const auto& [handle, cadence] : actor.entries) {
+				fn(handle, cadence);
+			}
+		}
+	};
+
+	void TestSupervisorLoop()
+	{
+		using Loop = SupervisorLoop<FakeLoopTraits>;
+		Loop loop;
+		const Loop::Budget unlimited{};
+
+		const auto player = loop.Add();
+		const auto follower = loop.Add();
+		for (std::uint16_t i = 0; i < 4; ++i) {
+			loop[player].entries.push_back({ SlotHandle{ i, 0 }, i < 2 ? 0.25f : 1.0f });
+			loop[follower].entries.push_back({ SlotHandle{ i, 0 }, 0.5f });
+		}
+		loop.Reschedule(player);
+		loop.Reschedule(follower);
+		CHECK(loop.pending() == 8);
+
+		// Two simulated seconds at 20 passes/s: each entry comes up once per cadence
+		for (int pass = 0; pass < 40; ++pass) {
+			loop.Pass(0.05f, unlimited);
+		}
+		const auto count = [](const FakeActor& actor, std::uint16_t entry) { return std::ranges::count(actor.validated, entry); };
+		CHECK(count(loop[player], 0) == 8 && count(loop[player], 1) == 8);
+		CHECK(count(loop[player], 2) == 2 && count(loop[player], 3) == 2);
+		CHECK(count(loop[follower], 0) == 4);
+		CHECK(loop[player].sweeps == 8);  // once per pass in which its checks came up
+
+		// A budget of one entry per pass carries the rest over, oldest first
+		loop[player].validated.clear();
+		loop.RequestCheck(SlotHandle{ 3, 0 });
+		loop.RequestCheck(SlotHandle{ 3, 0 });  // flagged twice, validated once
+		loop.Pass(0.0f, { .enabled = true, .entries = 1 });
+		CHECK(loop[player].validated == std::vector<std::uint16_t>{ 3 });
+		loop.Pass(0.0f, { .enabled = true, .entries = 1 });
+		CHECK(loop[player].validated.size() == 1);
+
+		// A dropped entry leaves the wheel and the flagged queue alike
+		loop.RequestCheck(SlotHandle{ 0, 0 });
+		loop.Forget(player, SlotHandle{ 0, 0 });
+		loop[player].entries.erase(loop[player].entries.begin());
+		loop[player].validated.clear();
+		for (int pass = 0; pass < 40; ++pass) {
+			loop.Pass(0.05f, unlimited);
+		}
+		CHECK(count(loop[player], 0) == 0);
+		CHECK(count(loop[player], 1) == 8);
+
+		// An actor that fails to resolve parks on its first check and costs nothing after
+		loop[follower].loaded = false;
+		loop[follower].validated.clear();
+		for (int pass = 0; pass < 40; ++pass) {
+			loop.Pass(0.05f, unlimited);
+		}
+		CHECK(loop.parked(follower) && loop.parkedCount() == 1);
+		CHECK(FakeLoopTraits::parks == 1);
+		CHECK(loop[follower].validated.empty());
+		CHECK(loop.pending() == 3);  // the player's three remaining entries
+
+		loop[follower].loaded = true;
+		loop.Reschedule(follower);
+		CHECK(!loop.parked(follower) && loop.parkedCount() == 0);
+		for (int pass = 0; pass < 10; ++pass) {
+			loop.Pass(0.05f, unlimited);
+		}
+		CHECK(count(loop[follower], 0) == 1);
+
+		// The player is never parked
+		loop[player].loaded = false;
+		for (int pass = 0; pass < 40; ++pass) {
+			loop.Pass(0.05f, unlimited);
+		}
+		CHECK(!loop.parked(player));
+
+		loop.Clear();
+		CHECK(loop.empty() && loop.pending() == 0 && loop.parkedCount() == 0);
+	}
+
+	// ===== Deadline queue ====================================================
+
+	void TestDeadlineQueue()
+	{
+		DeadlineQueue<std::uint32_t> queue;
+		std::map<std::uint32_t, double> model;
+		double now = 0.0;
+
+		for (int step = 0; step < 50000; ++step) {
+			switch (Roll(5)) {
+			case 0:
+			case 1:
+				{
+					const auto key = static_cast<std::uint32_t>(rng() % 500);
+					const auto deadline = now + static_cast<double>(Roll(1000)) / 100.0;
+					queue.ScheduleNoEarlier(key, deadline);
+					auto [it, added] = model.try_emplace(key, deadline);
+					if (!added && deadline > it->second) {
+						it->second = deadline;
+					}
+					break;
+				}
+			case 2:
+				{
+					const auto key = static_cast<std::uint32_t>(rng() % 500);
+					queue.Erase(key);
+					model.erase(key);
+					break;
+				}
+			default:
+				{
+					now += static_cast<double>(Roll(100)) / 100.0;
+
+					std::vector<std::uint32_t> due;
+					queue.PopDue(now, due);
+
+					std::vector<std::pair<double, std::uint32_t>> expect;
+					for (auto it = model.begin(); it != model.end();) {
+						if (it->second <= now) {
+							expect.emplace_back(it->second, it->first);
+							it = model.erase(it);
+						} else {
+							++it;
+						}
+					}
+					CHECK(due.size() == expect.size());
+
+					// Earliest first; ties may come out in any order
+					std::ranges::sort(expect);
+					const std::set<std::uint32_t> dueSet(due.begin(), due.end());
+					CHECK(dueSet.size() == due.size());
+					for (const auto& [deadline, key] : expect) {
+						CHECK(dueSet.contains(key));
+					}
+					for (std::size_t i = 1; i < due.size() && i < expect.size(); ++i) {
+						CHECK(expect[i - 1].first <= expect[i].first);
+					}
+					break;
+				}
+			}
+
+			CHECK(queue.size() == model.size());
+			if (!model.empty()) {
+				double earliest = model.begin()->second;
+				for (const auto& [key, deadline] : model) {
+					earliest = (std::min)(earliest, deadline);
+				}
+				CHECK(queue.next() == earliest);
+			}
+		}
+
+		queue.Clear();
+		CHECK(queue.empty());
+	}
+
+	void TestRestoreSchedule()
+	{
+		RestoreSchedule<int> schedule;
+		std::vector<int> due;
+
+		// One hitch passes every deadline; the frame guard still holds each key for two frames
+		schedule.AdvanceFrame();
+		schedule.Arm(1, 0.5);
+		schedule.Arm(2, 0.5);
+		schedule.Arm(3, 0.5);
+		schedule.Forget(3);
+
+		schedule.AdvanceFrame();
+		schedule.PopDue(10.0, 2, due);
+		CHECK(due.empty());
+		CHECK(schedule.size() == 2);
+
+		schedule.Arm(2, 0.1);  // re-arming restarts the guard but never pulls the deadline in
+		schedule.AdvanceFrame();
+		schedule.PopDue(10.0, 2, due);
+		CHECK(due == std::vector<int>{ 1 });
+
+		due.clear();
+		schedule.AdvanceFrame();
+		schedule.PopDue(10.0, 2, due);
+		CHECK(due == std::vector<int>{ 2 });
+		CHECK(schedule.empty());
+
+		// Without a hitch the deadline is what holds a key back
+		due.clear();
+		schedule.Arm(4, 12.0);
+		for (int frame = 0; frame < 5; ++frame) {
+			schedule.AdvanceFrame();
+			schedule.PopDue(11.0, 2, due);
+		}
+		CHECK(due.empty());
+		schedule.PopDue(12.0, 2, due);
+		CHECK(due == std::vector<int>{ 4 });
+
+		schedule.Arm(5, 1.0);
+		schedule.Clear();
+		CHECK(schedule.empty());
+	}
+
+	// ===== Latency histogram =================================================
+
+	void TestLatencyHistogram()
+	{
+		LatencyHistogram histogram;
+		CHECK(histogram.SnapshotAndReset().count == 0);
+
+		for (const std::uint64_t value : { 0ull, 1ull, 7ull, 8ull, 9ull, 1000ull, 123456ull, 987654321ull }) {
+			histogram.Record(value);
+			const auto s = histogram.SnapshotAndReset();
+			CHECK(s.count == 1);
+			CHECK(s.max == value);
+			CHECK(s.p50 <= value);
+			CHECK(static_cast<double>(s.p50) >= static_cast<double>(value) * 0.875);
+		}
+
+		// 1..1000 uniformly: quantiles land within the bucket precision
+		for (std::uint64_t v = 1; v <= 1000; ++v) {
+			histogram.Record(v);
+		}
+		const auto s = histogram.SnapshotAndReset();
+		CHECK(s.count == 1000);
+		CHECK(s.max == 1000);
+		const auto near = [](std::uint64_t got, double want) {
+			return static_cast<double>(got) >= want * 0.875 && static_cast<double>(got) <= want * 1.125;
+		};
+		CHECK(near(s.p50, 500.0));
+		CHECK(near(s.p95, 950.0));
+		CHECK(near(s.p99, 990.0));
+		CHECK(histogram.SnapshotAndReset().count == 0);
+	}
+
+	// ===== Upkeep pricing ====================================================
+
+	void TestUpkeepPricing()
+	{
+		// Neutral duration pays the base cost; half the duration pays 2^exponent times it
+		const std::vector<float> base{ 40.0f, 40.0f, 40.0f, 0.0f, 0.2f, 33.0f, 17.0f, 90.0f, 12.5f };
+		const std::vector<float> dur{ 60.0f, 30.0f, 0.0f, 60.0f, 600.0f, 45.0f, 120.0f, 5.0f, 60.0f };
+		std::vector<float> out(base.size());
+
+		UpkeepPricing::PriceBatch(base, dur, 60.0f, 1.0f, 1.0f, out);
+		CHECK(out[0] == 40.0f);
+		CHECK(out[1] == 80.0f);
+		CHECK(out[2] == 40.0f);  // unknown duration priced as neutral
+		CHECK(out[3] == 0.0f);   // free spells stay free
+		CHECK(out[4] == 1.0f);   // everything else costs at least 1
+
+		// The batch matches pricing one spell at a time, across the vector tail
+		UpkeepPricing::PriceBatch(base, dur, 60.0f, 0.65f, 0.8f, out);
+		for (std::size_t i = 0; i < base.size(); ++i) {
+			float one = 0.0f;
+			UpkeepPricing::PriceBatch({ &base[i], 1 }, { &dur[i], 1 }, 60.0f, 0.65f, 0.8f, { &one, 1 });
+			CHECK(std::fabs(out[i] - one) <= 1.0f);
+		}
+
+		// Neutral <= 0 disables the duration scaling
+		UpkeepPricing::PriceBatch(base, dur, 0.0f, 0.65f, 0.5f, out);
+		CHECK(out[1] == 40.0f);
+		CHECK(out[5] == 33.0f);
+	}
+
+	// ===== Binary reading ====================================================
+
+	std::span<const std::byte> AsBytes(std::string_view s)
+	{
+		return { reinterpret_cast<const std::byte*>(s.data()), s.size() };
+	}
+
+	void TestCrc32c()
+	{
+		CHECK(Crc32c(AsBytes("123456789")) == 0xE3069283u);
+		CHECK(Crc32c({}) == 0u);
+
+		// Chained updates equal a single pass
+		const std::string_view text = "The quick brown fox jumps over the lazy dog";
+		const auto whole = Crc32c(AsBytes(text));
+		CHECK(Crc32c(AsBytes(text.substr(10)), Crc32c(AsBytes(text.substr(0, 10)))) == whole);
+	}
+
+	void TestSpanReader()
+	{
+		const std::array<std::byte, 7> bytes{ std::byte{ 1 }, std::byte{ 0 }, std::byte{ 0 }, std::byte{ 0 },
+			std::byte{ 'a' }, std::byte{ 'b' }, std::byte{ 'c' } };
+
+		SpanReader in{ bytes };
+		std::uint32_t value = 0;
+		CHECK(in.Read(value) && value == 1);
+		CHECK(in.offset() == 4 && in.remaining() == 3);
+		CHECK(in.TakeString(2) == "ab");
+
+		// A short read latches: later reads fail even when they would fit
+		std::uint16_t wide = 0;
+		CHECK(!in.Read(wide));
+		CHECK(!in.ok());
+		CHECK(in.Take(1).empty());
+		CHECK(in.TakeString(0).empty());
+		CHECK(in.remaining() == 1);
+
+		SpanReader empty{ {} };
+		CHECK(empty.Take(0).empty() && empty.ok());
+		CHECK(!empty.Read(value) && !empty.ok());
+	}
+
+	// ===== SKSE co-save directory ============================================
+
+	// Appends co-save headers and chunk data; Plugin() returns the offset of its length
+	// field so tests can corrupt it
+	struct CosaveBuilder
+	{
+		std::vector<std::byte> bytes;
+
+		template <class T>
+		void Put(const T& value)
+		{
+			const auto* raw = reinterpret_cast<const std::byte*>(&value);
+			bytes.insert(bytes.end(), raw, raw + sizeof(T));
+		}
+
+		void File(std::uint32_t plugins) { Put(CosaveDirectory::FileHeader{ { 'S', 'K', 'S', 'E' }, 2, 0x2000000, 0x1060640, plugins }); }
+
+		struct Chunk
+		{
+			std::uint32_t type;
+			std::string data;
+		};
+
+		std::size_t Plugin(std::uint32_t uid, const std::vector<Chunk>& chunks)
+		{
+			std::uint32_t length = 0;
+			for (const auto& c : chunks) {
+				length += static_cast<std::uint32_t>(sizeof(CosaveDirectory::ChunkHeader) + c.data.size());
+			}
+			const auto at = bytes.size() + offsetof(CosaveDirectory::PluginHeader, length);
+			Put(CosaveDirectory::PluginHeader{ uid, static_cast<std::uint32_t>(chunks.size()), length });
+			for (const auto& c : chunks) {
+				Put(CosaveDirectory::ChunkHeader{ c.type, 1, static_cast<std::uint32_t>(c.data.size()) });
+				for (const char ch : c.data) {
+					bytes.push_back(static_cast<std::byte>(ch));
+				}
+			}
+			return at;
+		}
+	};
+
+	void TestCosaveDirectory()
+	{
+		using CosaveDirectory::Status;
+		constexpr std::uint32_t kOurs = 0x474D544D;  // 'MTMG'
+		constexpr std::uint32_t kOther = 0x43535045;
+
+		// Only chunks starting with "ok" are accepted
+		const auto accept = [](std::span<const std::byte> chunk) {
+			return chunk.size() >= 2 && chunk[0] == std::byte{ 'o' } && chunk[1] == std::byte{ 'k' };
+		};
+		const auto text = [](std::span<const std::byte> chunk) {
+			return std::string_view{ reinterpret_cast<const char*>(chunk.data()), chunk.size() };
+		};
+
+		// Several plugins; ours in the middle, behind another plugin's chunk of our type
+		CosaveBuilder multi;
+		multi.File(3);
+		multi.Plugin(kOther, { { kOurs, "ok-not-ours" }, { 1, "x" } });
+		multi.Plugin(kOurs, { { 7, "other type" }, { kOurs, "ok-ours" } });
+		multi.Plugin(kOther, { { 2, "tail" } });
+
+		auto found = CosaveDirectory::FindChunk(multi.bytes, kOurs, kOurs, accept);
+		CHECK(found.status == Status::kFound);
+		CHECK(text(found.chunk) == "ok-ours");
+		CHECK(found.rejected == 0);
+
+		CHECK(CosaveDirectory::FindChunk(multi.bytes, 0x12345678, kOurs, accept).status == Status::kNotFound);
+
+		// A block of ours with no usable chunk does not end the search
+		CosaveBuilder twoBlocks;
+		twoBlocks.File(3);
+		twoBlocks.Plugin(kOurs, { { kOurs, "bad header" } });
+		twoBlocks.Plugin(kOther, { { 1, "x" } });
+		twoBlocks.Plugin(kOurs, { { kOurs, "ok-second" } });
+
+		found = CosaveDirectory::FindChunk(twoBlocks.bytes, kOurs, kOurs, accept);
+		CHECK(found.status == Status::kFound);
+		CHECK(text(found.chunk) == "ok-second");
+		CHECK(found.rejected == 1);
+
+		// Malformed: bad signature, and a chunk length past its block
+		auto unsigned_ = multi.bytes;
+		unsigned_[0] = std::byte{ 'X' };
+		CHECK(CosaveDirectory::FindChunk(unsigned_, kOurs, kOurs, accept).status == Status::kNotCosave);
+		CHECK(CosaveDirectory::FindChunk({}, kOurs, kOurs, accept).status == Status::kNotCosave);
+
+		CosaveBuilder overlong;
+		overlong.File(2);
+		overlong.Plugin(kOurs, { { kOurs, "ok-cut" } });
+		const auto chunkLength = overlong.bytes.size() - std::string_view{ "ok-cut" }.size() - sizeof(std::uint32_t);
+		overlong.bytes[chunkLength] = std::byte{ 0x7F };
+		overlong.Plugin(kOurs, { { kOurs, "ok-next" } });
+		found = CosaveDirectory::FindChunk(overlong.bytes, kOurs, kOurs, accept);
+		CHECK(found.status == Status::kFound);
+		CHECK(text(found.chunk) == "ok-next");
+		CHECK(found.rejected == 1);
+
+		// A plugin length past the end of the file stops the walk
+		CosaveBuilder oversized;
+		oversized.File(2);
+		const auto lengthAt = oversized.Plugin(kOther, { { 1, "x" } });
+		oversized.Plugin(kOurs, { { kOurs, "ok" } });
+		oversized.bytes[lengthAt + 3] = std::byte{ 0x10 };
+		CHECK(CosaveDirectory::FindChunk(oversized.bytes, kOurs, kOurs, accept).status == Status::kTruncated);
+
+		// Truncated anywhere: never reads past the end, never reports a chunk that was cut
+		for (std::size_t size = 0; size < multi.bytes.size(); ++size) {
+			const auto cut = std::span{ multi.bytes }.first(size);
+			found = CosaveDirectory::FindChunk(cut, kOurs, kOurs, accept);
+			if (found.status == Status::kFound) {
+				CHECK(text(found.chunk) == "ok-ours");
+				CHECK(found.chunk.data() + found.chunk.size() <= cut.data() + cut.size());
+			} else {
+				CHECK(size < sizeof(CosaveDirectory::FileHeader) ? found.status == Status::kNotCosave : found.status == Status::kTruncated);
+			}
+		}
+	}
+
+	// ===== Byte pattern search ===============================================
+
+	void TestPatternSearch()
+	{
+		const std::string_view needle = "MTMG_MaintainedMagic_CosaveV2!!";
+		std::vector<PatternSearch::SearchFn> kernels{ &PatternSearch::Scalar };
+#if defined(MAINT_CORE_X64)
+		kernels.push_back(&PatternSearch::SSE2);
+		if (PatternSearch::CPUHasAVX2()) {
+			kernels.push_back(&PatternSearch::AVX2);
+		}
+#endif
+		kernels.push_back(PatternSearch::Select());
+
+		for (int round = 0; round < 300; ++round) {
+			std::vector<std::byte> buffer(needle.size() + Roll(600));
+			for (auto& b : buffer) {
+				// Small alphabet drawn from the needle, so first/last-byte hits are common
+				b = static_cast<std::byte>(needle[Roll(4) == 0 ? 0 : Roll(needle.size())]);
+			}
+
+			const auto plant = [&](std::size_t at, std::size_t keep) {
+				std::memcpy(buffer.data() + at, needle.data(), needle.size());
+				if (keep < needle.size()) {
+					buffer[at + keep] = std::byte{ 0 };  // near miss: breaks one byte
+				}
+			};
+			for (int i = 0; i < 6; ++i) {
+				plant(Roll(buffer.size() - needle.size() + 1), Roll(needle.size() + 4));
+			}
+
+			const auto limit = buffer.size() - needle.size() + 1;
+			for (std::size_t from = 0; from <= limit; from += 1 + Roll(40)) {
+				const auto expect = PatternSearch::Scalar(buffer, from, limit, needle);
+				if (expect < limit) {
+					CHECK(std::memcmp(buffer.data() + expect, needle.data(), needle.size()) == 0);
+				}
+				for (const auto kernel : kernels) {
+					CHECK(kernel(buffer, from, limit, needle) == expect);
+				}
+			}
+		}
+
+		CHECK(PatternSearch::NameOf(PatternSearch::Select()) != "");
+	}
+}
+
+int main()
+{
+	TestSlotTable();
+	TestDenseTable();
+	TestTwoLevelBitmap();
+	TestIdRangeAllocator();
+	TestDenseIdFlags();
+	TestInlineIdSet();
+	TestEffectIndex();
+	TestTimingWheel();
+	TestSupervisorLoop();
+	TestDeadlineQueue();
+	TestRestoreSchedule();
+	TestLatencyHistogram();
+	TestUpkeepPricing();
+	TestCrc32c();
+	TestSpanReader();
+	TestCosaveDirectory();
+	TestPatternSearch();
+
+	if (failures != 0) {
+		std::fprintf(stderr, "%d check(s) failed\n", failures);
+		return 1;
+	}
+	std::printf("All Core checks passed (pattern search: %s)\n",
+		std::string(PatternSearch::NameOf(PatternSearch::Select())).c_str());
+	return 0;
+}
@@ -0,0 +1,91 @@
+// Engine stand-ins for driving the Core templates on the host. They mirror the shape of the
+// CommonLibSSE types the plugin binds (an actor's active effect list, effects tagged with a
+// unique ID and their source spell) without any of the engine behind them.
+
+#pragma once
+
+#include "Core.hpp"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace StandIn
+{
+	struct Spell
+	{
+		bool maintainedKeyword{ false };  // KywdMaintainedSpell
+	};
+
+	struct Effect
+	{
+		std::uint16_t uniqueID{ 0 };
+		Spell* spell{ nullptr };
+		float elapsedSeconds{ 0.0f };
+	};
+
+	// Registered base spell -> its maintained infinite spell
+	using Registry = std::unordered_map<const Spell*, Spell*>;
+
+	struct Actor
+	{
+		std::uint32_t formID{ 0 };
+		std::vector<Effect*> effects{};  // GetActiveEffectList()
+		const Registry* registry{ nullptr };
+	};
+
+	// Core::EffectIndex traits; classification matches EngineEffects in Run.hpp
+	struct Effects
+	{
+		using Actor = StandIn::Actor;
+		using Effect = StandIn::Effect;
+		using Spell = StandIn::Spell;
+		using Key = std::uint32_t;
+		using Context = const Registry*;
+
+		struct Classification
+		{
+			Spell* spell{ nullptr };
+			bool pinned{ false };
+		};
+
+		struct RebuildProbe
+		{};
+
+		static Key KeyOf(const Actor* actor) noexcept { return actor->formID; }
+		static constexpr Key WatchedKey() noexcept { return 0x14; }
+		static Context ContextFor(const Actor* actor) noexcept { return actor->registry; }
+
+		template <class Fn>
+		static void ForEachEffect(const Actor* actor, Fn&& fn)
+		{
+			for (auto* e : actor->effects) {
+				if (e && !fn(e)) {
+					break;
+				}
+			}
+		}
+
+		static std::uint16_t IdOf(const Effect* e) noexcept { return e->uniqueID; }
+		static bool CameFrom(const Effect* e, const Spell* spell) noexcept { return e->spell && e->spell == spell; }
+		static void Pin(Effect* e) noexcept { e->elapsedSeconds = 0.0f; }
+
+		static Classification Classify(Context registry, Effect* e)
+		{
+			if (!e->spell) {
+				return {};
+			}
+			if (registry) {
+				if (const auto it = registry->find(e->spell); it != registry->end()) {
+					return { it->second, false };
+				}
+			}
+			if (e->spell->maintainedKeyword) {
+				return { e->spell, true };
+			}
+			return {};
+		}
+	};
+
+	using EffectIndex = Maint::Core::EffectIndex<Effects>;
+}
@@ -0,0 +1,586 @@
+// Headless run of the upkeep supervisor's engine-independent parts: the validation loop,
+// the per-actor effect index, the dense registry, the FormID range and the FX restore
+// schedule, driven by synthetic actors. Reports ticks/s and heap allocations per tick;
+// compare numbers across changes on the same machine.
+//
+// Usage: core_sim [frames]   (60 frames per simulated second; default 36000)
+// Exits non-zero when the world does not settle back into a fully maintained state.
+
+#include "Core.hpp"
+#include "StandIns.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <new>
+#include <random>
+#include <string>
+
+using namespace Maint::Core;
+
+// ===== Allocation counter ====================================================
+
+namespace
+{
+	std::atomic<std::uint64_t> allocations{ 0 };
+}
+
+void* operator new(std::size_t size)
+{
+	allocations.fetch_add(1, std::memory_order_relaxed);
+	if (void* p = std::malloc(size ? size : 1)) {
+		return p;
+	}
+	throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size) { return ::operator new(size); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+namespace
+{
+	constexpr float kFrame = 1.0f / 60.0f;
+	constexpr std::size_t kActors = 4;  // the player and three followers
+	constexpr std::size_t kMaintained = 32;
+	constexpr std::size_t kBackgroundSpells = 64;
+	constexpr std::size_t kBackgroundEffects = 300;
+	constexpr float kConjureRecastDelay = 1.0f;
+	constexpr float kRecastBoundAfter = 1.0f;  // the player re-equips a dispelled bound weapon
+	constexpr double kFXSilenceSeconds = 2.0;
+
+	enum class Kind : std::uint8_t
+	{
+		kBuff,
+		kCloak,
+		kConjure,
+		kBound
+	};
+
+	Kind KindOf(std::size_t base) noexcept
+	{
+		switch (base % 8) {
+		case 0:
+			return Kind::kConjure;
+		case 1:
+			return base == 1 ? Kind::kBound : Kind::kBuff;  // one bound weapon per actor
+		case 2:
+			return Kind::kCloak;
+		default:
+			return Kind::kBuff;
+		}
+	}
+
+	float CadenceFor(Kind kind) noexcept
+	{
+		switch (kind) {
+		case Kind::kConjure:
+		case Kind::kBound:
+			return 0.25f;
+		case Kind::kCloak:
+			return 2.0f;
+		default:
+			return 0.5f;
+		}
+	}
+
+	struct Pair
+	{
+		StandIn::Spell* infinite{ nullptr };
+		Kind kind{ Kind::kBuff };
+		std::uint8_t effects{ 0 };  // effects of the infinite spell
+		std::uint8_t base{ 0 };     // index into Body::bases
+		std::uint32_t infiniteID{ 0 };
+		std::uint32_t debuffID{ 0 };
+		bool markedForRemoval{ false };
+		bool recastQueued{ false };
+		float recastRemaining{ 0.0f };
+	};
+
+	using Registry = DenseTable<StandIn::Spell*, Pair>;  // keyed by base spell
+
+	struct Body
+	{
+		StandIn::Actor actor{};
+		std::array<StandIn::Spell, kMaintained> bases{};
+		std::array<StandIn::Spell, kMaintained> infinites{};
+		std::array<StandIn::Spell, kBackgroundSpells> background{};
+		StandIn::Spell otherWeapon{};
+		const StandIn::Spell* rightHand{ nullptr };
+		bool loaded{ true };
+		float unloadedFor{ 0.0f };
+	};
+
+	struct Supervised
+	{
+		std::uint16_t slot{ 0 };
+		Body* body{ nullptr };
+		Registry registry{};
+		StandIn::EffectIndex cache{};
+	};
+
+	struct SimLoopTraits
+	{
+		using Handle = SlotHandle;
+		using Slot = Supervised;
+		using Live = Body*;
+
+		static constexpr float kTickSeconds = 0.05f;
+		static constexpr std::size_t kWheelSize = 64;
+
+		struct PassProbe
+		{};
+
+		static Body* Resolve(std::uint16_t slot, Supervised& state);
+		static bool Validate(Supervised& state, Body* body, SlotHandle handle);
+		static void Sweep(Supervised& state, Body* body);
+		static bool Holds(const Supervised& state, SlotHandle handle) { return state.registry.Resolve(handle) >= 0; }
+		static float CadenceOf(const Supervised& state, SlotHandle handle)
+		{
+			return CadenceFor(state.registry.column<0>()[static_cast<std::size_t>(state.registry.Resolve(handle))].kind);
+		}
+		static void Parked(const Supervised& state);
+
+		template <class Fn>
+		static void ForEachEntry(const Supervised& state, Fn&& fn)
+		{
+			const auto pairs = state.registry.column<0>();
+			for (std::size_t i = 0; i < pairs.size(); ++i) {
+				fn(state.registry.HandleAt(i), CadenceFor(pairs[i].kind));
+			}
+		}
+	};
+
+	using Loop = SupervisorLoop<SimLoopTraits>;
+
+	struct Counters
+	{
+		std::uint64_t validations{ 0 };
+		std::uint64_t conjureDeaths{ 0 };
+		std::uint64_t conjureRecasts{ 0 };
+		std::uint64_t boundSwaps{ 0 };
+		std::uint64_t dispels{ 0 };
+		std::uint64_t maintains{ 0 };
+		std::uint64_t parks{ 0 };
+		std::uint64_t restores{ 0 };
+	};
+
+	struct PendingMaintain
+	{
+		std::uint16_t slot;
+		std::uint8_t base;
+		float remaining;
+	};
+
+	// Everything the engine would own; the traits reach it through `world`
+	struct World
+	{
+		std::deque<Body> bodies{};
+		std::vector<StandIn::Effect> effects = std::vector<StandIn::Effect>(0x10000);  // by unique ID
+		std::vector<std::uint16_t> freeIDs{};
+		IdRangeAllocator formIDs{ 0xFE000000, 0x800, 1024 };
+		RestoreSchedule<StandIn::Effect*> fx{};
+		std::vector<PendingMaintain> maintainQueue{};
+		std::vector<StandIn::Effect*> restored{};
+		std::vector<StandIn::Spell*> removals{};
+		double now{ 0.0 };
+		Counters counters{};
+		std::mt19937_64 rng{ 0x4D544D47 };
+	};
+
+	World world;
+	Loop loop;
+
+	std::size_t Roll(std::size_t n) { return static_cast<std::size_t>(world.rng() % n); }
+
+	// ----- Engine stand-in: active effect lists -----
+
+	StandIn::Effect* Apply(Body& body, StandIn::Spell* spell)
+	{
+		const auto id = world.freeIDs.back();
+		world.freeIDs.pop_back();
+
+		auto& e = world.effects[id];
+		e = { id, spell, 0.0f };
+		body.actor.effects.push_back(&e);
+		StandIn::EffectIndex::OnEffectChanged(body.actor.formID, id, true);
+		return &e;
+	}
+
+	void RemoveAt(Body& body, std::size_t index)
+	{
+		auto* e = body.actor.effects[index];
+		body.actor.effects[index] = body.actor.effects.back();
+		body.actor.effects.pop_back();
+
+		StandIn::EffectIndex::OnEffectChanged(body.actor.formID, e->uniqueID, false);
+		world.fx.Forget(e);
+		world.freeIDs.push_back(e->uniqueID);
+	}
+
+	std::size_t RemoveAllOf(Body& body, const StandIn::Spell* spell)
+	{
+		std::size_t removed = 0;
+		for (std::size_t i = body.actor.effects.size(); i-- > 0;) {
+			if (body.actor.effects[i]->spell == spell) {
+				RemoveAt(body, i);
+				++removed;
+			}
+		}
+		return removed;
+	}
+
+	// ----- Plugin stand-in: maintaining and dispelling -----
+
+	void Maintain(std::uint16_t slot, std::uint8_t base)
+	{
+		auto& state = loop[slot];
+		auto& body = *state.body;
+
+		const auto infiniteID = world.formIDs.Allocate();
+		const auto debuffID = world.formIDs.Allocate();
+		if (!infiniteID || !debuffID) {
+			return;
+		}
+
+		Pair pair{ .infinite = &body.infinites[base], .kind = KindOf(base), .base = base, .infiniteID = *infiniteID, .debuffID = *debuffID };
+		pair.effects = pair.kind == Kind::kBuff ? static_cast<std::uint8_t>(1 + base % 3) : std::uint8_t{ 1 };
+		for (std::uint8_t i = 0; i < pair.effects; ++i) {
+			world.fx.Arm(Apply(body, pair.infinite), world.now + kFXSilenceSeconds);
+		}
+		if (pair.kind == Kind::kBound) {
+			body.rightHand = pair.infinite;
+		}
+
+		// Registry changes resync every index, as MaintainedRegistry does
+		const auto handle = state.registry.Insert(&body.bases[base], pair);
+		StandIn::EffectIndex::Invalidate();
+		loop.Schedule(slot, handle, CadenceFor(pair.kind));
+		++world.counters.maintains;
+	}
+
+	void Dispel(std::uint16_t slot, std::size_t index)
+	{
+		auto& state = loop[slot];
+		auto& pair = state.registry.column<0>()[index];
+
+		loop.Forget(slot, state.registry.HandleAt(index));
+		RemoveAllOf(*state.body, pair.infinite);
+		world.formIDs.Free(pair.infiniteID);
+		world.formIDs.Free(pair.debuffID);
+		if (pair.kind == Kind::kBound) {
+			world.maintainQueue.push_back({ slot, pair.base, kRecastBoundAfter });
+		}
+
+		state.registry.EraseAt(index);
+		StandIn::EffectIndex::Invalidate();
+		++world.counters.dispels;
+	}
+
+	// ----- Supervisor hooks -----
+
+	Body* SimLoopTraits::Resolve(std::uint16_t slot, Supervised& state)
+	{
+		auto* body = slot == 0 || state.body->loaded ? state.body : nullptr;
+		if (body) {
+			state.cache.GetFor(&body->actor);
+		}
+		return body;
+	}
+
+	bool SimLoopTraits::Validate(Supervised& state, Body* body, SlotHandle handle)
+	{
+		const auto index = state.registry.Resolve(handle);
+		if (index < 0) {
+			return false;
+		}
+		++world.counters.validations;
+
+		auto& pair = state.registry.column<0>()[static_cast<std::size_t>(index)];
+		const auto* found = state.cache.find(pair.infinite);
+		const auto count = found ? found->size() : 0;
+
+		switch (pair.kind) {
+		case Kind::kBound:
+			pair.markedForRemoval = body->rightHand != pair.infinite;
+			break;
+		case Kind::kConjure:
+			if (!pair.recastQueued && count < pair.effects) {
+				pair.recastQueued = true;
+				pair.recastRemaining = kConjureRecastDelay;
+			}
+			break;
+		default:
+			pair.markedForRemoval = count != pair.effects;
+			break;
+		}
+		return true;
+	}
+
+	void SimLoopTraits::Sweep(Supervised& state, Body*)
+	{
+		const auto pairs = state.registry.column<0>();
+		for (std::size_t i = pairs.size(); i-- > 0;) {
+			if (pairs[i].markedForRemoval) {
+				Dispel(state.slot, i);
+			}
+		}
+	}
+
+	void SimLoopTraits::Parked(const Supervised&) { ++world.counters.parks; }
+
+	void Setup()
+	{
+		world.freeIDs.reserve(world.effects.size());
+		for (std::size_t id = world.effects.size() - 1; id > 0; --id) {
+			world.freeIDs.push_back(static_cast<std::uint16_t>(id));
+		}
+
+		for (std::size_t a = 0; a < kActors; ++a) {
+			auto& body = world.bodies.emplace_back();
+			body.actor.formID = a == 0 ? StandIn::Effects::WatchedKey() : static_cast<std::uint32_t>(0xFF000800 + a);
+			body.actor.effects.reserve(kBackgroundEffects + 2 * kMaintained * 3);
+			for (auto& spell : body.infinites) {
+				spell.maintainedKeyword = true;
+			}
+			for (std::size_t i = 0; i < kBackgroundEffects; ++i) {
+				Apply(body, &body.background[Roll(kBackgroundSpells)]);
+			}
+
+			const auto slot = loop.Add();
+			loop[slot].slot = slot;
+			loop[slot].body = &body;
+			loop[slot].registry.reserve(kMaintained);
+		}
+		for (std::uint16_t slot = 0; slot < kActors; ++slot) {
+			for (std::uint8_t base = 0; base < kMaintained; ++base) {
+				Maintain(slot, base);
+			}
+		}
+	}
+
+	// ----- One frame -----
+
+	void WorldEvents()
+	{
+		for (std::uint16_t slot = 0; slot < kActors; ++slot) {
+			auto& body = *loop[slot].body;
+
+			// Potions, enchantments and hits come and go about twice a second
+			if (Roll(30) == 0) {
+				if (Roll(2) == 0 || body.actor.effects.size() < kBackgroundEffects / 2) {
+					Apply(body, &body.background[Roll(kBackgroundSpells)]);
+				} else {
+					for (std::size_t tries = 0; tries < 4; ++tries) {
+						const auto at = Roll(body.actor.effects.size());
+						if (!body.actor.effects[at]->spell->maintainedKeyword) {
+							RemoveAt(body, at);
+							break;
+						}
+					}
+				}
+			}
+
+			// A summon dies every few seconds somewhere in the party
+			if (Roll(180 * kActors) == 0) {
+				const auto base = static_cast<std::uint8_t>(8 * Roll(kMaintained / 8));
+				if (RemoveAllOf(body, &body.infinites[base]) != 0) {
+					++world.counters.conjureDeaths;
+				}
+			}
+
+			// Followers wander out of the loaded area now and then
+			if (slot != 0) {
+				if (body.loaded && Roll(1800) == 0) {
+					body.loaded = false;
+					body.unloadedFor = 0.0f;
+				} else if (!body.loaded && (body.unloadedFor += kFrame) >= 3.0f) {
+					body.loaded = true;
+					if (loop.parked(slot)) {
+						loop.Reschedule(slot);  // OnActorLoaded
+					}
+				}
+			}
+		}
+
+		// The player swaps the bound weapon hand for a real weapon every few seconds
+		auto& player = *loop[0].body;
+		if (player.rightHand == &player.infinites[1] && Roll(300) == 0) {
+			player.rightHand = &player.otherWeapon;
+			++world.counters.boundSwaps;
+		}
+	}
+
+	void Recasts(float deltaSeconds)
+	{
+		for (std::size_t i = world.maintainQueue.size(); i-- > 0;) {
+			auto& pending = world.maintainQueue[i];
+			if ((pending.remaining -= deltaSeconds) <= 0.0f) {
+				Maintain(pending.slot, pending.base);
+				world.maintainQueue[i] = world.maintainQueue.back();
+				world.maintainQueue.pop_back();
+			}
+		}
+
+		for (std::uint16_t slot = 0; slot < kActors; ++slot) {
+			auto& state = loop[slot];
+			for (auto& pair : state.registry.column<0>()) {
+				if (!pair.recastQueued || (pair.recastRemaining -= deltaSeconds) > 0.0f) {
+					continue;
+				}
+				if (!state.body->loaded) {
+					continue;
+				}
+				RemoveAllOf(*state.body, pair.infinite);
+				for (std::uint8_t n = 0; n < pair.effects; ++n) {
+					Apply(*state.body, pair.infinite);
+				}
+				pair.recastQueued = false;
+				++world.counters.conjureRecasts;
+			}
+		}
+	}
+
+	// UpkeepSupervisor::ValidateScheduled followed by EffectRestorer::Update
+	void Supervise(float deltaSeconds)
+	{
+		auto& player = loop[0];
+		if (StandIn::EffectIndex::HasPendingDeltas() && !player.registry.empty()) {
+			player.cache.GetFor(&player.body->actor);
+			player.cache.TakeRemovals(world.removals);
+			for (auto* maintained : world.removals) {
+				const auto pairs = player.registry.column<0>();
+				for (std::size_t i = 0; i < pairs.size(); ++i) {
+					if (pairs[i].infinite == maintained) {
+						loop.RequestCheck(player.registry.HandleAt(i));
+					}
+				}
+			}
+			world.removals.clear();
+		}
+
+		loop.Pass(deltaSeconds, {});
+
+		world.now += deltaSeconds;
+		world.fx.AdvanceFrame();
+		world.restored.clear();
+		world.fx.PopDue(world.now, 2, world.restored);
+		world.counters.restores += world.restored.size();
+	}
+
+	void Frame(bool events)
+	{
+		if (events) {
+			WorldEvents();
+		}
+		Recasts(kFrame);
+		Supervise(kFrame);
+	}
+
+	// Every actor is loaded and holds all of its maintained spells with their full effect sets
+	int CheckSettled()
+	{
+		int problems = 0;
+		for (std::uint16_t slot = 0; slot < kActors; ++slot) {
+			auto& state = loop[slot];
+			const auto& view = state.cache.GetFor(&state.body->actor);
+			if (state.registry.size() != kMaintained) {
+				std::fprintf(stderr, "actor %u: %zu of %zu spells maintained\n", slot, state.registry.size(), kMaintained);
+				++problems;
+			}
+			for (const auto& pair : state.registry.column<0>()) {
+				const auto* found = view.find(pair.infinite);
+				if (!found || found->size() != pair.effects || pair.recastQueued) {
+					std::fprintf(stderr, "actor %u: maintained spell %u lost its effects\n", slot, pair.base);
+					++problems;
+				}
+			}
+		}
+		if (world.formIDs.count() != 2 * kActors * kMaintained) {
+			std::fprintf(stderr, "%zu FormIDs allocated, expected %zu\n", world.formIDs.count(), 2 * kActors * kMaintained);
+			++problems;
+		}
+		if (!world.fx.empty()) {
+			std::fprintf(stderr, "%zu FX restores still pending\n", world.fx.size());
+			++problems;
+		}
+		return problems;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const std::size_t frames = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 36000;
+	constexpr std::size_t kWarmup = 600;
+
+	Setup();
+	for (std::size_t i = 0; i < kWarmup; ++i) {
+		Frame(true);
+	}
+
+	const auto rebuilds = [] {
+		std::size_t total = 0;
+		for (std::uint16_t slot = 0; slot < kActors; ++slot) {
+			total += loop[slot].cache.rebuilds();
+		}
+		return total;
+	};
+	const auto rebuildsBefore = rebuilds();
+	const auto countersBefore = world.counters;
+	const auto allocationsBefore = allocations.load(std::memory_order_relaxed);
+	const auto start = std::chrono::steady_clock::now();
+
+	for (std::size_t i = 0; i < frames; ++i) {
+		Frame(true);
+	}
+
+	const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	const auto allocated = allocations.load(std::memory_order_relaxed) - allocationsBefore;
+	const auto& c = world.counters;
+	const auto perTick = [&](std::uint64_t n) { return frames ? static_cast<double>(n) / static_cast<double>(frames) : 0.0; };
+
+	std::size_t activeEffects = 0;
+	for (std::uint16_t slot = 0; slot < kActors; ++slot) {
+		activeEffects += loop[slot].body->actor.effects.size();
+	}
+
+	std::printf("%zu actors x %zu maintained spells, %zu active effects, %zu ticks (%.0f s simulated)\n",
+		kActors, kMaintained, activeEffects, frames, static_cast<double>(frames) * kFrame);
+	std::printf("%-44s %14.0f\n", "ticks/s", static_cast<double>(frames) / seconds);
+	std::printf("%-44s %14.3f\n", "allocations/tick", perTick(allocated));
+	std::printf("%-44s %14.2f\n", "validations/tick", perTick(c.validations - countersBefore.validations));
+	std::printf("%-44s %14zu\n", "effect index rebuilds", rebuilds() - rebuildsBefore);
+	std::printf("%-44s %14llu / %llu\n", "conjure deaths / recasts",
+		static_cast<unsigned long long>(c.conjureDeaths - countersBefore.conjureDeaths),
+		static_cast<unsigned long long>(c.conjureRecasts - countersBefore.conjureRecasts));
+	std::printf("%-44s %14llu / %llu\n", "bound swaps / dispels",
+		static_cast<unsigned long long>(c.boundSwaps - countersBefore.boundSwaps),
+		static_cast<unsigned long long>(c.dispels - countersBefore.dispels));
+	std::printf("%-44s %14llu\n", "follower parks", static_cast<unsigned long long>(c.parks - countersBefore.parks));
+	std::printf("%-44s %14llu\n", "FX restores", static_cast<unsigned long long>(c.restores - countersBefore.restores));
+
+	// Quiet period: followers come home and every pending recast and restore lands
+	for (std::uint16_t slot = 1; slot < kActors; ++slot) {
+		auto& body = *loop[slot].body;
+		if (!body.loaded) {
+			body.loaded = true;
+			if (loop.parked(slot)) {
+				loop.Reschedule(slot);
+			}
+		}
+	}
+	for (int i = 0; i < 600; ++i) {
+		Frame(false);
+	}
+
+	if (const auto problems = CheckSettled(); problems != 0) {
+		std::fprintf(stderr, "%d problem(s) after settling\n", problems);
+		return 1;
+	}
+	return 0;
+}